@@ -0,0 +1,313 @@
+#pragma once
+#ifndef _PCRE2CPP_BENCHMARK_BENCHMARK_HPP_
+	#define _PCRE2CPP_BENCHMARK_BENCHMARK_HPP_
+
+	#include <algorithm>
+	#include <chrono>
+	#include <cmath>
+	#include <cstdio>
+	#include <fstream>
+	#include <new_delete_counter.hpp>
+	#include <string>
+	#include <string_view>
+	#include <utility>
+	#include <vector>
+
+namespace bench {
+	/// @brief options of benchmark run (set from command line)
+	struct run_options {
+		/// @brief only benchmarks which full name contains filter are run
+		std::string filter;
+		/// @brief path of JSON output (empty when JSON isn't written)
+		std::string json_path;
+		/// @brief minimal time of measurement of one benchmark in seconds
+		double min_time	   = 0.2;
+		/// @brief size of the biggest generated subject in bytes
+		size_t max_size	   = 16 * 1024 * 1024;
+		/// @brief minimal count of samples of one benchmark
+		size_t min_samples = 5;
+		/// @brief maximal count of samples of one benchmark
+		size_t max_samples = 100'000;
+		/// @brief set of run benchmarks (workloads, redos or all)
+		std::string set	   = "workloads";
+		/// @brief time of one operation in seconds after which ReDoS sweep of variant stops
+		double budget	   = 0.05;
+		/// @brief directory of corpus written by pcre2cpp-fuzz which is replayed (empty when it isn't replayed)
+		std::string corpus_path;
+	};
+
+	/// @brief count of global operator new calls of current thread (counted by new_delete_counter.cpp)
+	using alloc_stats = new_delete_counter::new_stats;
+
+	/// @brief returns count of allocations made by current thread since its start
+	inline alloc_stats get_alloc_stats() noexcept { return new_delete_counter::get_thread_stats(); }
+
+	/// @brief measured benchmark
+	struct result {
+		std::string group;
+		std::string name;
+		std::string library;
+		/// @brief count of all measured operations
+		size_t iterations	  = 0;
+		/// @brief count of operations measured in one sample (latency of one operation is its average)
+		size_t batch		  = 0;
+		/// @brief count of subject bytes processed by one operation
+		size_t bytes_per_op	  = 0;
+		double ns_per_op	  = 0.0;
+		double bytes_per_sec  = 0.0;
+		double p50_ns		  = 0.0;
+		double p99_ns		  = 0.0;
+		double p999_ns		  = 0.0;
+		/// @brief standard deviation of latency samples
+		double stddev_ns	  = 0.0;
+		/// @brief count of latency samples
+		size_t samples		  = 0;
+		/// @brief count of global operator new calls of one operation (after warm up)
+		size_t allocs_per_op  = 0;
+		/// @brief bytes allocated by one operation (after warm up)
+		size_t alloc_bytes	  = 0;
+
+		/// @brief returns name used by filter and comparison of results
+		std::string full_name() const { return group + "/" + name + "/" + library; }
+	};
+
+	/// @brief latency of one benchmark measured for growing subject sizes
+	struct growth_curve {
+		/// @brief name of benchmark without size of subject
+		std::string name;
+		std::vector<size_t> sizes;
+		std::vector<double> ns_per_op;
+		/// @brief how operation ended for every size (e.g. no_match or match_limit)
+		std::vector<std::string> outcomes;
+
+		/// @brief slope of ln(time) over ln(size), which is degree of polynomial growth
+		double get_degree() const {
+			std::vector<double> xs;
+			std::vector<double> ys;
+				for (size_t i = 0; i != sizes.size(); ++i) {
+					xs.push_back(std::log(static_cast<double>(sizes[i])));
+					ys.push_back(std::log(std::max(ns_per_op[i], 1.0)));
+				}
+			return _slope(xs, ys);
+		}
+
+		/// @brief slope of log2(time) over size, which is count of time doublings per character of exponential growth
+		double get_doublings_per_char() const {
+			std::vector<double> xs;
+			std::vector<double> ys;
+				for (size_t i = 0; i != sizes.size(); ++i) {
+					xs.push_back(static_cast<double>(sizes[i]));
+					ys.push_back(std::log2(std::max(ns_per_op[i], 1.0)));
+				}
+			return _slope(xs, ys);
+		}
+
+	private:
+		/// @brief returns slope of least squares line (0 when there are less than 2 points)
+		static double _slope(const std::vector<double>& xs, const std::vector<double>& ys) {
+				if (xs.size() < 2) { return 0.0; }
+
+			double mean_x = 0.0;
+			double mean_y = 0.0;
+				for (size_t i = 0; i != xs.size(); ++i) {
+					mean_x += xs[i];
+					mean_y += ys[i];
+				}
+			mean_x /= static_cast<double>(xs.size());
+			mean_y /= static_cast<double>(ys.size());
+
+			double covariance = 0.0;
+			double variance	  = 0.0;
+				for (size_t i = 0; i != xs.size(); ++i) {
+					covariance += (xs[i] - mean_x) * (ys[i] - mean_y);
+					variance   += (xs[i] - mean_x) * (xs[i] - mean_x);
+				}
+			return variance == 0.0 ? 0.0 : covariance / variance;
+		}
+	};
+
+	/// @brief prevents compiler from removing computation of value
+	template<class T>
+	inline void do_not_optimize(const T& value) {
+	#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+	#else
+		static const volatile void* sink = nullptr;
+		sink							 = &value;
+	#endif
+	}
+
+	/// @brief returns value at quantile of sorted samples
+	inline double percentile(const std::vector<double>& sorted, const double quantile) {
+			if (sorted.empty()) { return 0.0; }
+		const size_t idx = static_cast<size_t>(quantile * static_cast<double>(sorted.size()));
+		return sorted[std::min(idx, sorted.size() - 1)];
+	}
+
+	/// @brief escapes string for JSON
+	inline std::string json_escape(const std::string_view text) {
+		std::string out;
+		out.reserve(text.size());
+			for (const char c : text) {
+					switch (c) {
+						case '"': out += "\\\""; break;
+						case '\\': out += "\\\\"; break;
+						case '\n': out += "\\n"; break;
+						case '\t': out += "\\t"; break;
+						default:
+								if (static_cast<unsigned char>(c) < 0x20) {
+									char code[8];
+									std::snprintf(code, sizeof(code), "\\u%04x", c);
+									out += code;
+								}
+								else { out += c; }
+							break;
+					}
+			}
+		return out;
+	}
+
+	/// @brief runs benchmarks, prints them and collects results
+	class suite {
+	private:
+		using _clock = std::chrono::steady_clock;
+
+		run_options _options;
+		std::vector<result> _results;
+		std::vector<growth_curve> _curves;
+
+		/// @brief returns time of batch of operations in nanoseconds
+		template<class Func>
+		static double _time_batch(Func& func, const size_t batch) {
+			const auto start = _clock::now();
+				for (size_t i = 0; i != batch; ++i) { func(); }
+			return std::chrono::duration<double, std::nano>(_clock::now() - start).count();
+		}
+
+	public:
+		explicit suite(run_options options) : _options(std::move(options)) {}
+
+		/// @brief returns run options
+		const run_options& get_options() const noexcept { return _options; }
+
+		/// @brief returns true if benchmark with given full name is selected by filter
+		bool is_selected(const std::string& full_name) const {
+			return _options.filter.empty() || full_name.find(_options.filter) != std::string::npos;
+		}
+
+		/**
+		 * @brief measures func. Operations are timed in batches which take at least 1 us (so clock overhead doesn't
+		 * matter), samples are collected until min time passes and latency percentiles are computed from them
+		 * @param group group of benchmark (e.g. workload)
+		 * @param name name of benchmark (e.g. subject)
+		 * @param library measured library
+		 * @param bytes_per_op count of subject bytes processed by one operation (0 when throughput has no sense)
+		 * @param func measured operation
+		 * @return measured result (valid until next run) or nullptr when benchmark isn't selected
+		 */
+		template<class Func>
+		const result* run(const std::string& group, const std::string& name, const std::string& library,
+		  const size_t bytes_per_op, Func&& func) {
+			result res{ group, name, library };
+				if (!is_selected(res.full_name())) { return nullptr; }
+
+			// warm up and calibrate batch size
+			const double first_ns = std::max(_time_batch(func, 1), 1.0);
+			res.batch			  = std::max<size_t>(static_cast<size_t>(1000.0 / first_ns), 1);
+
+			// allocations of one operation are counted outside of measurement
+			const alloc_stats allocs_before = get_alloc_stats();
+			func();
+			const alloc_stats allocs_after = get_alloc_stats();
+			res.allocs_per_op			   = allocs_after.allocations - allocs_before.allocations;
+			res.alloc_bytes				   = allocs_after.bytes - allocs_before.bytes;
+
+			std::vector<double> samples;
+			double total_ns = 0.0;
+				while (samples.size() < _options.max_samples &&
+					   (samples.size() < _options.min_samples || total_ns < _options.min_time * 1e9)) {
+					const double batch_ns = _time_batch(func, res.batch);
+					total_ns			  += batch_ns;
+					samples.push_back(batch_ns / static_cast<double>(res.batch));
+				}
+
+			res.iterations	  = samples.size() * res.batch;
+			res.bytes_per_op  = bytes_per_op;
+			res.ns_per_op	  = total_ns / static_cast<double>(res.iterations);
+			res.bytes_per_sec = bytes_per_op == 0 ? 0.0 : static_cast<double>(bytes_per_op) / res.ns_per_op * 1e9;
+
+			std::sort(samples.begin(), samples.end());
+			res.p50_ns	= percentile(samples, 0.5);
+			res.p99_ns	= percentile(samples, 0.99);
+			res.p999_ns = percentile(samples, 0.999);
+			res.samples = samples.size();
+
+			double mean = 0.0;
+				for (const double sample : samples) { mean += sample; }
+			mean /= static_cast<double>(samples.size());
+
+			double variance = 0.0;
+				for (const double sample : samples) { variance += (sample - mean) * (sample - mean); }
+			res.stddev_ns = samples.size() > 1 ? std::sqrt(variance / static_cast<double>(samples.size() - 1)) : 0.0;
+
+			std::printf("[[BENCHMARK]] %-60s %14.1f ns/op %10.1f MB/s  p50 %12.1f  p99 %12.1f  p999 %12.1f ns %6zu allocs/op\n",
+			  res.full_name().c_str(), res.ns_per_op, res.bytes_per_sec / 1e6, res.p50_ns, res.p99_ns, res.p999_ns,
+			  res.allocs_per_op);
+			std::fflush(stdout);
+			_results.push_back(std::move(res));
+			return &_results.back();
+		}
+
+		/// @brief returns measured results
+		const std::vector<result>& get_results() const noexcept { return _results; }
+
+		/// @brief prints growth curve and adds it to JSON output (curves without points are skipped)
+		void add_curve(growth_curve curve) {
+				if (curve.sizes.empty()) { return; }
+
+			std::printf("[[CURVE]] %-62s %4zu sizes  degree %6.2f  doublings/char %6.3f  last %s\n", curve.name.c_str(),
+			  curve.sizes.size(), curve.get_degree(), curve.get_doublings_per_char(), curve.outcomes.back().c_str());
+			std::fflush(stdout);
+			_curves.push_back(std::move(curve));
+		}
+
+		/// @brief returns added growth curves
+		const std::vector<growth_curve>& get_curves() const noexcept { return _curves; }
+
+		/// @brief writes results as JSON to path, returns false when file can't be written
+		bool write_json(const std::string& path) const {
+			std::ofstream out(path);
+				if (!out) { return false; }
+
+			out << "{\n  \"benchmarks\": [";
+				for (size_t i = 0; i != _results.size(); ++i) {
+					const result& res = _results[i];
+					out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << json_escape(res.full_name()) << "\", \"group\": \""
+						<< json_escape(res.group) << "\", \"subject\": \"" << json_escape(res.name) << "\", \"library\": \""
+						<< json_escape(res.library) << "\", \"iterations\": " << res.iterations << ", \"batch\": " << res.batch
+						<< ", \"bytes_per_op\": " << res.bytes_per_op << ", \"ns_per_op\": " << res.ns_per_op
+						<< ", \"bytes_per_second\": " << res.bytes_per_sec << ", \"p50_ns\": " << res.p50_ns
+						<< ", \"p99_ns\": " << res.p99_ns << ", \"p999_ns\": " << res.p999_ns
+						<< ", \"stddev_ns\": " << res.stddev_ns << ", \"samples\": " << res.samples
+						<< ", \"allocs_per_op\": " << res.allocs_per_op << ", \"alloc_bytes_per_op\": " << res.alloc_bytes << "}";
+				}
+			out << "\n  ],\n  \"curves\": [";
+				for (size_t i = 0; i != _curves.size(); ++i) {
+					const growth_curve& curve = _curves[i];
+					out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << json_escape(curve.name)
+						<< "\", \"degree\": " << curve.get_degree()
+						<< ", \"doublings_per_char\": " << curve.get_doublings_per_char() << ", \"points\": [";
+						for (size_t j = 0; j != curve.sizes.size(); ++j) {
+							out << (j == 0 ? "" : ", ") << "{\"size\": " << curve.sizes[j]
+								<< ", \"ns_per_op\": " << curve.ns_per_op[j] << ", \"outcome\": \""
+								<< json_escape(curve.outcomes[j]) << "\"}";
+						}
+					out << "]}";
+				}
+			out << "\n  ]\n}\n";
+			return static_cast<bool>(out);
+		}
+	};
+} // namespace bench
+
+#endif
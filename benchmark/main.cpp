@@ -1,49 +1,291 @@
 #include <pch.hpp>
+#include <redos.hpp>
 
-void benchmark(const std::string_view name, const mstd::function_view<void()> func, const size_t iterations) {
-	const auto start = std::chrono::high_resolution_clock::now();
-		for (size_t i = 0; i < iterations; ++i) { func(); }
-	const auto end											= std::chrono::high_resolution_clock::now();
-	const std::chrono::duration<double, std::milli> elapsed = end - start;
+#pragma region SUBJECTS
 
-	std::cout << fmt::format("[[BENCHMARK]] {} ({} iterations):", name, iterations) << elapsed.count() << " ms" << std::endl;
+/// @brief generated subject
+struct subject {
+	std::string name;
+	std::string text;
+};
+
+/// @brief returns text cut to size (without cutting UTF-8 sequence)
+std::string cut_text(std::string text, size_t size) {
+		if (text.size() <= size) { return text; }
+		while (size != 0 && (static_cast<unsigned char>(text[size]) & 0xC0) == 0x80) { --size; }
+	text.resize(size);
+	return text;
 }
 
-int main() {
-	const std::string pattern = R"((\w+([-+.']\w+)*@\w+([-.]\w+)*\.\w+([-.]\w+)*))";
-	const std::string subject = "Moj adres to test.email@example.com, a inny to kontakt@firma.pl";
-	constexpr int iterations  = 100'00;
+/// @brief returns log like ASCII text of given size (the same for every run)
+std::string make_log_text(const size_t size) {
+	static const std::vector<std::string_view> levels = { "INFO", "DEBUG", "WARN", "error", "warning", "critical" };
+	static const std::vector<std::string_view> words  = { "request", "user", "connection", "timeout", "handled", "cache",
+		 "miss", "retry", "session", "closed", "the", "request", "failed", "ok" };
 
-	std::cout << "Starting benchmark...\n" << std::endl;
+	std::mt19937 rng(42);
+	std::string text;
+	text.reserve(size + 256);
+		while (text.size() < size) {
+			text += "2025-01-01T12:00:00 ";
+			text += levels[rng() % levels.size()];
+			const size_t words_count = 3 + rng() % 8;
+				for (size_t i = 0; i != words_count; ++i) {
+					text += ' ';
+					text += words[rng() % words.size()];
+				}
+			text += " id=" + std::to_string(rng() % 100000) + " user=u" + std::to_string(rng() % 1000);
+				if (rng() % 16 == 0) { text += " contact: test.email@example.com"; }
+				if (rng() % 64 == 0) { text += " connection timeout"; }
+			text += '\n';
+		}
+	return cut_text(std::move(text), size);
+}
+
+/// @brief returns text with many non ASCII characters of given size (the same for every run)
+std::string make_utf_text(const size_t size) {
+	static const std::vector<std::string_view> words = { "zażółć", "gęślą", "jaźń", "привет", "мир", "日本語", "テキスト",
+		"αβγ", "hello", "world", "naïve", "café" };
+
+	std::mt19937 rng(7);
+	std::string text;
+	text.reserve(size + 64);
+		while (text.size() < size) {
+			text += words[rng() % words.size()];
+			text += rng() % 12 == 0 ? '\n' : ' ';
+		}
+	return cut_text(std::move(text), size);
+}
+
+/// @brief returns human readable size
+std::string size_name(const size_t size) {
+		if (size >= 1024 * 1024) { return std::to_string(size / (1024 * 1024)) + "MiB"; }
+		if (size >= 1024) { return std::to_string(size / 1024) + "KiB"; }
+	return std::to_string(size) + "B";
+}
+
+#pragma endregion
+
+#pragma region WORKLOADS
+
+/// @brief pattern with subjects on which it is measured
+struct workload {
+	std::string name;
+	std::string pattern;
+	pcre2cpp::compile_options opts;
+	/// @brief subjects are UTF text instead of log text
+	bool utf_subject;
+	/// @brief std::regex supports pattern
+	bool has_std_regex;
+	/// @brief values of all groups of all matches are extracted instead of counting matches
+	bool extract_captures = false;
+};
+
+/// @brief PCRE2 C API regex (code, match data with one offset pair and match data with offsets of all groups)
+class raw_regex {
+private:
+	pcre2_code_8* _code					 = nullptr;
+	pcre2_match_data_8* _match_data		 = nullptr;
+	pcre2_match_data_8* _groups_match_data = nullptr;
+	bool _utf							 = false;
+
+	/// @brief returns offset of next search after match (whole character is skipped after empty match in UTF mode)
+	size_t _next_offset(const std::string_view text, const PCRE2_SIZE* offsetVector) const {
+			if (offsetVector[1] > offsetVector[0]) { return offsetVector[1]; }
+
+		size_t offset = offsetVector[0] + 1;
+			if (_utf) {
+				while (offset < text.size() && (static_cast<unsigned char>(text[offset]) & 0xC0) == 0x80) { ++offset; }
+			}
+		return offset;
+	}
+
+public:
+	raw_regex(const std::string& pattern, const uint32_t opts) : _utf((opts & PCRE2_UTF) != 0) {
+		int error_code;
+		PCRE2_SIZE error_offset;
+		_code			   = pcre2_compile_8(reinterpret_cast<PCRE2_SPTR8>(pattern.c_str()), pattern.size(), opts, &error_code,
+				   &error_offset, nullptr);
+		_match_data		   = pcre2_match_data_create_8(1, nullptr);
+		_groups_match_data = pcre2_match_data_create_from_pattern_8(_code, nullptr);
+	}
+
+	raw_regex(const raw_regex&)			   = delete;
+	raw_regex& operator=(const raw_regex&) = delete;
+
+	~raw_regex() {
+		pcre2_match_data_free_8(_groups_match_data);
+		pcre2_match_data_free_8(_match_data);
+		pcre2_code_free_8(_code);
+	}
+
+	/// @brief returns count of all matches (the same way as pcre2cpp::regex::count_matches)
+	size_t count_matches(const std::string_view text) const {
+		size_t count  = 0;
+		size_t offset = 0;
+		uint32_t opts = 0;
+			while (pcre2_match_8(_code, reinterpret_cast<PCRE2_SPTR8>(text.data()), text.size(), offset, opts, _match_data,
+					 nullptr) >= 0) {
+				++count;
+				offset = _next_offset(text, pcre2_get_ovector_pointer_8(_match_data));
+				// subject was checked by first match
+				opts   = PCRE2_NO_UTF_CHECK;
+			}
+		return count;
+	}
+
+	/// @brief returns count of all matches and copies values of their groups (like pcre2cpp::regex::match_all)
+	size_t extract_captures(const std::string_view text) const {
+		std::vector<std::vector<std::string>> results;
+		size_t offset					= 0;
+		uint32_t opts					= 0;
+		const PCRE2_SIZE* offsetVector = pcre2_get_ovector_pointer_8(_groups_match_data);
+		int match_code;
+			while ((match_code = pcre2_match_8(_code, reinterpret_cast<PCRE2_SPTR8>(text.data()), text.size(), offset, opts,
+					  _groups_match_data, nullptr)) > 0) {
+				std::vector<std::string>& values = results.emplace_back();
+					for (size_t i = 0; i != static_cast<size_t>(match_code); ++i) {
+						const size_t start = offsetVector[i * 2];
+							if (start == PCRE2_UNSET) { values.emplace_back(); }
+							else { values.emplace_back(text.substr(start, offsetVector[i * 2 + 1] - start)); }
+					}
+				offset = _next_offset(text, offsetVector);
+				opts   = PCRE2_NO_UTF_CHECK;
+			}
+		bench::do_not_optimize(results);
+		return results.size();
+	}
+};
+
+/// @brief returns count of all matches found by std::regex
+size_t std_count_matches(const std::regex& re, const std::string& text) {
+	return static_cast<size_t>(std::distance(std::sregex_iterator(text.begin(), text.end(), re), std::sregex_iterator()));
+}
+
+/// @brief returns count of all matches found by std::regex and copies values of their groups
+size_t std_extract_captures(const std::regex& re, const std::string& text) {
+	std::vector<std::vector<std::string>> results;
+		for (auto it = std::sregex_iterator(text.begin(), text.end(), re); it != std::sregex_iterator(); ++it) {
+			std::vector<std::string>& values = results.emplace_back();
+				for (size_t i = 0; i != it->size(); ++i) { values.push_back(it->str(i)); }
+		}
+	bench::do_not_optimize(results);
+	return results.size();
+}
+
+/// @brief returns count of all matches found by pcre2cpp and creates their results
+size_t pcre2cpp_extract_captures(const pcre2cpp::regex& re, const std::string& text) {
+	std::vector<pcre2cpp::match_result> results;
+	re.match_all(text, results);
+	bench::do_not_optimize(results);
+	return results.size();
+}
+
+/// @brief checks that all libraries find the same count of matches, returns false when they don't
+bool check_counts(const std::string& name, const size_t expected, const size_t count, const std::string_view library) {
+		if (count == expected) { return true; }
+	std::fprintf(stderr, "[[MISMATCH]] %s: %s found %zu matches, pcre2cpp found %zu\n", name.c_str(), library.data(), count,
+	  expected);
+	return false;
+}
+
+/// @brief measures counting of all matches (or extraction of their groups) of workload on subjects with every library
+bool run_workload(bench::suite& suite, const workload& work, const std::vector<subject>& subjects) {
+	// std::regex in libstdc++ recurses for every character, so it is measured only on small subjects
+	constexpr size_t max_std_regex_size = 64 * 1024;
 
-#pragma region COMPILATION_BENCHMARK
+	const pcre2cpp::regex re(work.pattern, work.opts);
+	const raw_regex raw_re(work.pattern, static_cast<uint32_t>(work.opts));
+	const std::regex std_re = work.has_std_regex ? std::regex(work.pattern) : std::regex();
 
-	// --- 1. std::regex compilation ---
-	benchmark("std::regex compilation", [&]() -> void { const std::regex std_re(pattern); }, iterations);
+	// every function returns count of matches
+	const auto pcre2cpp_run = [&](const std::string& text) {
+		return work.extract_captures ? pcre2cpp_extract_captures(re, text) : re.count_matches(text);
+	};
+	const auto raw_run = [&](const std::string& text) {
+		return work.extract_captures ? raw_re.extract_captures(text) : raw_re.count_matches(text);
+	};
+	const auto std_run = [&](const std::string& text) {
+		return work.extract_captures ? std_extract_captures(std_re, text) : std_count_matches(std_re, text);
+	};
 
-	// --- 2. PCRE2 C compilation ---
-	benchmark(
-	  "PCRE2 C compilation",
-	  [&]() -> void {
-		  int errorNumber;
-		  PCRE2_SIZE errorOffset;
-		  pcre2_code_8* re_c = pcre2_compile_8(reinterpret_cast<PCRE2_SPTR8>(pattern.c_str()), pattern.length(), 0, &errorNumber,
-			&errorOffset, nullptr);
-		  pcre2_match_data_8* match_data = pcre2_match_data_create_from_pattern_8(re_c, nullptr);
+	bool is_valid = true;
+		for (const subject& subj : subjects) {
+			const std::string name = work.name + "/" + subj.name;
+				if (!suite.is_selected(name)) { continue; }
 
-		  pcre2_match_data_free_8(match_data);
-		  pcre2_code_free_8(re_c);
-	  },
-	  iterations
-	);
+			const size_t expected = pcre2cpp_run(subj.text);
+			is_valid			  &= check_counts(name, expected, raw_run(subj.text), "PCRE2 C");
 
-	// --- 3. pcre2cpp::regex compilation ---
-	benchmark(
-	  "pcre2cpp::regex compilation", [&]() -> void { const pcre2cpp::regex pcre2cpp_re(pattern); }, iterations
-	);
+			suite.run(work.name, subj.name, "pcre2cpp", subj.text.size(),
+			  [&]() { bench::do_not_optimize(pcre2cpp_run(subj.text)); });
+			suite.run(work.name, subj.name, "pcre2", subj.text.size(), [&]() { bench::do_not_optimize(raw_run(subj.text)); });
+
+				if (!work.has_std_regex || subj.text.size() > max_std_regex_size) { continue; }
+
+			is_valid &= check_counts(name, expected, std_run(subj.text), "std::regex");
+			suite.run(work.name, subj.name, "std_regex", subj.text.size(),
+			  [&]() { bench::do_not_optimize(std_run(subj.text)); });
+		}
+	return is_valid;
+}
+
+/// @brief measures all workloads on log and UTF subjects, returns false when libraries found different matches
+bool run_workloads(bench::suite& suite) {
+	using pcre2cpp::compile_options_bits;
+	const std::vector<workload> workloads = {
+		{ "literal", "connection timeout", compile_options_bits::None, false, true },
+		{ "alternation", "error|warning|critical|fatal|panic", compile_options_bits::None, false, true },
+		{ "captures", R"((\w+)=(\w+))", compile_options_bits::None, false, true, true },
+		{ "email", R"((\w+([-+.']\w+)*@\w+([-.]\w+)*\.\w+([-.]\w+)*))", compile_options_bits::None, false, true },
+		{ "backtracking", R"((?:\w+\s+){3,6}?failed)", compile_options_bits::None, false, true },
+		{ "backreference", R"(\b(\w+)\s+\1\b)", compile_options_bits::None, false, true },
+		{ "utf_literal", "gęślą jaźń", compile_options_bits::UTF, true, true },
+		{ "utf_class", R"(\p{Cyrillic}+|\p{Han}+)", compile_options_bits::UTF, true, false },
+		{ "utf_words", R"(\w+ś\w*)", compile_options_bits::UTF | compile_options_bits::UCP, true, false },
+	};
+
+	// subjects from bytes to max size
+	std::vector<subject> log_subjects;
+	std::vector<subject> utf_subjects;
+		for (const size_t size : { size_t(64), size_t(4) << 10, size_t(64) << 10, size_t(1) << 20, size_t(16) << 20,
+				 size_t(256) << 20 }) {
+				if (size > suite.get_options().max_size) { break; }
+			log_subjects.push_back({ "log_" + size_name(size), make_log_text(size) });
+			utf_subjects.push_back({ "utf_" + size_name(size), make_utf_text(size) });
+		}
+
+	bool is_valid = true;
+		for (const workload& work : workloads) {
+			is_valid &= run_workload(suite, work, work.utf_subject ? utf_subjects : log_subjects);
+		}
+	return is_valid;
+}
 
 #pragma endregion
 
+#pragma region SINGLE_MATCH
+
+/// @brief measures compilation, single match and match with all results (on short subject)
+void run_single_match(bench::suite& suite) {
+	const std::string pattern = R"((\w+([-+.']\w+)*@\w+([-.]\w+)*\.\w+([-.]\w+)*))";
+	const std::string subj	  = "Moj adres to test.email@example.com, a inny to kontakt@firma.pl";
+	const std::string name	  = "email";
+
+	// --- compilation ---
+	suite.run("compile", name, "std_regex", 0, [&]() { bench::do_not_optimize(std::regex(pattern)); });
+	suite.run("compile", name, "pcre2", 0, [&]() {
+		int errorNumber;
+		PCRE2_SIZE errorOffset;
+		pcre2_code_8* re_c = pcre2_compile_8(reinterpret_cast<PCRE2_SPTR8>(pattern.c_str()), pattern.length(), 0, &errorNumber,
+		  &errorOffset, nullptr);
+		pcre2_match_data_8* match_data = pcre2_match_data_create_from_pattern_8(re_c, nullptr);
+
+		pcre2_match_data_free_8(match_data);
+		pcre2_code_free_8(re_c);
+	});
+	suite.run("compile", name, "pcre2cpp", 0, [&]() { bench::do_not_optimize(pcre2cpp::regex(pattern)); });
+
 	// COMPILED std::regex
 	const std::regex std_re(pattern);
 
@@ -57,87 +299,111 @@ int main() {
 	// COMPILED pcre2cpp::regex
 	const pcre2cpp::regex pcre2cpp_re(pattern);
 
-#pragma region MATCH_BENCHMARK
-
-	// --- 1. std::regex match ---
-	benchmark(
-	  "std::regex match",
-	  [&]() -> void {
-		  std::smatch match;
-		  std::regex_search(subject, match, std_re);
-	  },
-	  iterations
-	);
-
-	// --- 2. PCRE2 C match ---
-	benchmark(
-	  "PCRE2 C match",
-	  [&]() -> void {
-		  pcre2_match_8(re_c, reinterpret_cast<PCRE2_SPTR8>(subject.c_str()), subject.length(), 0, 0, match_data, nullptr);
-	  },
-	  iterations
-	);
-
-	// --- 3. pcre2cpp::regex match ---
-	benchmark("pcre2cpp::regex match", [&]() -> void { std::ignore = pcre2cpp_re.match(subject); }, iterations);
+	// --- match ---
+	suite.run("match", name, "std_regex", subj.size(), [&]() {
+		std::smatch match;
+		bench::do_not_optimize(std::regex_search(subj, match, std_re));
+	});
+	suite.run("match", name, "pcre2", subj.size(), [&]() {
+		bench::do_not_optimize(
+		  pcre2_match_8(re_c, reinterpret_cast<PCRE2_SPTR8>(subj.c_str()), subj.length(), 0, 0, match_data, nullptr));
+	});
+	suite.run("match", name, "pcre2cpp", subj.size(), [&]() { bench::do_not_optimize(pcre2cpp_re.match(subj)); });
 
-#pragma endregion
+	// --- match with all results ---
+	suite.run("match_all_results", name, "std_regex", subj.size(), [&]() {
+		std::smatch match;
+		std::regex_search(subj, match, std_re);
+		bench::do_not_optimize(match.str());
+	});
+	suite.run("match_all_results", name, "pcre2", subj.size(), [&]() {
+		const int errorCode =
+		  pcre2_match_8(re_c, reinterpret_cast<PCRE2_SPTR8>(subj.c_str()), subj.length(), 0, 0, match_data, nullptr);
+			if (errorCode <= 0) { return; }
 
-#pragma region MATCH_WITH_ALL_RESULTS
-
-	// --- 1. std::regex match with all results ---
-	benchmark(
-	  "std::regex match with all results",
-	  [&]() -> void {
-		  std::smatch match;
-		  std::regex_search(subject, match, std_re);
-		  const std::string result = match.str();
-	  },
-	  iterations
-	);
-
-	// --- 2. PCRE2 C match with all results ---
-	benchmark(
-	  "PCRE2 C match with all results",
-	  [&]() -> void {
-		  const int errorCode =
-			pcre2_match_8(re_c, reinterpret_cast<PCRE2_SPTR8>(subject.c_str()), subject.length(), 0, 0, match_data, nullptr);
-			  if (errorCode == PCRE2_ERROR_NOMATCH || errorCode <= 0) { return; }
-
-		  const size_t* offsetVector	  = pcre2_get_ovector_pointer_8(match_data);
-		  const size_t offsetVectorsCount = pcre2_get_ovector_count_8(match_data);
-
-		  auto results					  = std::vector<std::string>();
-		  results.reserve(offsetVectorsCount);
-			  for (size_t i = 0; i < offsetVectorsCount; ++i) {
-				  const size_t matchStart = offsetVector[i * 2];
-				  const size_t matchEnd	  = offsetVector[i * 2 + 1];
-
-					  if (matchStart == PCRE2_UNSET || matchEnd == PCRE2_UNSET) { results.emplace_back(); }
-					  else { results.emplace_back(std::next(subject.begin(), matchStart), std::next(subject.begin(), matchEnd)); }
-			  }
-	  },
-	  iterations
-	);
-
-	// --- 3. pcre2cpp::regex match ---
-	benchmark(
-	  "pcre2cpp::regex match with all results",
-	  [&]() -> void {
-		  pcre2cpp::match_result match;
-			  if (!pcre2cpp_re.match(subject, match)) { return; }
-
-		  std::vector<std::string> results = match.get_sub_results_values();
-		  results.insert(results.begin(), match.get_result_value());
-	  },
-	  iterations
-	);
+		const size_t* offsetVector		= pcre2_get_ovector_pointer_8(match_data);
+		const size_t offsetVectorsCount = pcre2_get_ovector_count_8(match_data);
 
-#pragma endregion
+		auto results					= std::vector<std::string>();
+		results.reserve(offsetVectorsCount);
+			for (size_t i = 0; i < offsetVectorsCount; ++i) {
+				const size_t matchStart = offsetVector[i * 2];
+				const size_t matchEnd	= offsetVector[i * 2 + 1];
+
+					if (matchStart == PCRE2_UNSET || matchEnd == PCRE2_UNSET) { results.emplace_back(); }
+					else { results.emplace_back(std::next(subj.begin(), matchStart), std::next(subj.begin(), matchEnd)); }
+			}
+		bench::do_not_optimize(results);
+	});
+	suite.run("match_all_results", name, "pcre2cpp", subj.size(), [&]() {
+		pcre2cpp::match_result match;
+			if (!pcre2cpp_re.match(subj, match)) { return; }
+
+		std::vector<std::string> results = match.get_sub_results_values();
+		results.insert(results.begin(), match.get_result_value());
+		bench::do_not_optimize(results);
+	});
 
 	// CLEAN UP
 	pcre2_match_data_free_8(match_data);
 	pcre2_code_free_8(re_c);
+}
+
+#pragma endregion
 
-	return 0;
-}
\ No newline at end of file
+void print_usage() {
+	std::fputs("Usage: pcre2cpp-benchmark [--set NAME] [--filter TEXT] [--json FILE] [--min-time SECONDS] [--max-size BYTES]\n"
+			   "                          [--budget SECONDS] [--corpus DIR]\n"
+			   "  --set NAME          runs workloads (default), redos (catastrophic patterns swept across sizes) or all\n"
+			   "  --filter TEXT       runs only benchmarks which name (group/subject/library) contains TEXT\n"
+			   "  --json FILE         writes results (and growth curves of redos) to FILE as JSON\n"
+			   "  --min-time SECONDS  minimal measurement time of one benchmark (default: 0.2)\n"
+			   "  --max-size BYTES    size of the biggest subject (default: 16 MiB, e.g. 268435456 for 256 MiB)\n"
+			   "  --budget SECONDS    time of one operation after which redos sweep stops (default: 0.05)\n"
+			   "  --corpus DIR        replays slow subjects written by pcre2cpp-fuzz to DIR (with variants of redos)\n",
+	  stderr);
+}
+
+/// @brief parses arguments, returns false when they are invalid
+bool parse_options(const int argc, char** argv, bench::run_options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view arg = argv[i];
+				if (i + 1 >= argc) { return false; }
+
+				if (arg == "--set") { options.set = argv[++i]; }
+				else if (arg == "--filter") { options.filter = argv[++i]; }
+				else if (arg == "--json") { options.json_path = argv[++i]; }
+				else if (arg == "--min-time") { options.min_time = std::strtod(argv[++i], nullptr); }
+				else if (arg == "--max-size") { options.max_size = std::strtoull(argv[++i], nullptr, 10); }
+				else if (arg == "--budget") { options.budget = std::strtod(argv[++i], nullptr); }
+				else if (arg == "--corpus") { options.corpus_path = argv[++i]; }
+				else { return false; }
+		}
+	return options.set == "workloads" || options.set == "redos" || options.set == "all";
+}
+
+int main(const int argc, char** argv) {
+	bench::run_options options;
+		if (!parse_options(argc, argv, options)) {
+			print_usage();
+			return 2;
+		}
+
+	bench::suite suite(options);
+	std::cout << "Starting benchmark...\n" << std::endl;
+
+	bool is_valid = true;
+		if (options.set != "redos") {
+			run_single_match(suite);
+			is_valid &= run_workloads(suite);
+		}
+		if (options.set != "workloads") { is_valid &= run_redos(suite, options.budget); }
+		if (!options.corpus_path.empty()) { is_valid &= run_corpus(suite, options.corpus_path); }
+
+		if (!options.json_path.empty() && !suite.write_json(options.json_path)) {
+			std::fprintf(stderr, "Can't write JSON to %s\n", options.json_path.c_str());
+			return 1;
+		}
+
+	return is_valid ? 0 : 1;
+}
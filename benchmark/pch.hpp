@@ -2,9 +2,17 @@
 #ifndef _PCRE2CPP_BENCHMARK_PCH_HPP_
 	#define _PCRE2CPP_BENCHMARK_PCH_HPP_
 
+	#include <benchmark.hpp>
 	#include <chrono>
+	#include <cstdio>
+	#include <filesystem>
+	#include <fstream>
 	#include <iostream>
+	#include <iterator>
 	#include <pcre2cpp/pcre2cpp.hpp>
+	#include <random>
 	#include <regex>
+	#include <string>
+	#include <vector>
 
 #endif
@@ -0,0 +1,216 @@
+#include <pch.hpp>
+#include <redos.hpp>
+
+#pragma region CASES
+
+const std::vector<redos_case>& get_redos_cases() {
+	// exponential cases grow by 2 characters per step (units of pair sizes have 2 characters), so next step after
+	// budget is at most few times slower
+	static const std::vector<size_t> exponential_sizes = { 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32 };
+	static const std::vector<size_t> pair_sizes		   = { 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+	static const std::vector<size_t> polynomial_sizes  = { 64, 256, 1024, 4096, 16384, 65536 };
+
+	static const std::vector<redos_case> cases = {
+		{ "nested_quantifier", "^(a+)+$", "a", "!", exponential_sizes },
+		{ "nested_star", "^(a*)*$", "a", "!", exponential_sizes },
+		{ "alternation", "^(a|aa)+$", "a", "!", exponential_sizes },
+		{ "overlapping_alternation", R"(^(\w|\d)+$)", "1", "!", exponential_sizes },
+		{ "nested_alternation", "^((a|b)+|ab)*c$", "ab", "!c", pair_sizes },
+		{ "words", R"(^(\w+\s?)*$)", "a", "!", exponential_sizes },
+		{ "adjacent_quantifiers", R"(^\d+\d+$)", "1", "x", polynomial_sizes },
+		{ "adjacent_wildcards", "^.*.*=.*;$", "=", ";x", polynomial_sizes },
+	};
+	return cases;
+}
+
+std::string make_redos_subject(const redos_case& redos, const size_t size) {
+	std::string subject;
+	subject.reserve(redos.unit.size() * size + redos.suffix.size());
+		for (size_t i = 0; i != size; ++i) { subject += redos.unit; }
+	return subject + redos.suffix;
+}
+
+#pragma endregion
+
+#pragma region VARIANTS
+
+/// @brief way of matching catastrophic case
+struct redos_variant {
+	std::string name;
+	/// @brief start of pattern options set before pattern of pcre2cpp::regex (e.g. (*LIMIT_MATCH=N))
+	std::string prefix;
+	/// @brief PCRE2 C API with match context is used instead of pcre2cpp::regex
+	bool is_pcre2;
+	/// @brief pattern is compiled with JIT (PCRE2 C API only)
+	bool jit;
+	/// @brief match limit set in match context (PCRE2 C API only)
+	uint32_t match_limit;
+};
+
+/// @brief PCRE2 C API regex with limits set in match context and optional JIT
+class limited_regex {
+private:
+	pcre2_code_8* _code				   = nullptr;
+	pcre2_match_data_8* _match_data	   = nullptr;
+	pcre2_match_context_8* _match_ctx = nullptr;
+
+public:
+	limited_regex(const std::string& pattern, const bool jit, const uint32_t match_limit) {
+		int error_code;
+		PCRE2_SIZE error_offset;
+		_code		= pcre2_compile_8(reinterpret_cast<PCRE2_SPTR8>(pattern.c_str()), pattern.size(), 0, &error_code,
+			  &error_offset, nullptr);
+		_match_data = pcre2_match_data_create_8(1, nullptr);
+		_match_ctx	= pcre2_match_context_create_8(nullptr);
+		pcre2_set_match_limit_8(_match_ctx, match_limit);
+		pcre2_set_depth_limit_8(_match_ctx, match_limit);
+		pcre2_set_heap_limit_8(_match_ctx, std::numeric_limits<uint32_t>::max());
+			if (jit) { pcre2_jit_compile_8(_code, PCRE2_JIT_COMPLETE); }
+	}
+
+	limited_regex(const limited_regex&)			   = delete;
+	limited_regex& operator=(const limited_regex&) = delete;
+
+	~limited_regex() {
+		pcre2_match_context_free_8(_match_ctx);
+		pcre2_match_data_free_8(_match_data);
+		pcre2_code_free_8(_code);
+	}
+
+	/// @brief returns pcre2 match code
+	int match(const std::string_view text) const {
+		return pcre2_match_8(_code, reinterpret_cast<PCRE2_SPTR8>(text.data()), text.size(), 0, 0, _match_data, _match_ctx);
+	}
+};
+
+/// @brief returns name of pcre2 match code
+std::string outcome_name(const int code) {
+		if (code >= 0) { return "match"; }
+		switch (code) {
+			case PCRE2_ERROR_NOMATCH: return "no_match";
+			case PCRE2_ERROR_MATCHLIMIT: return "match_limit";
+			case PCRE2_ERROR_DEPTHLIMIT: return "depth_limit";
+			case PCRE2_ERROR_HEAPLIMIT: return "heap_limit";
+			case PCRE2_ERROR_JIT_STACKLIMIT: return "jit_stack_limit";
+			default: return "error_" + std::to_string(code);
+		}
+}
+
+/// @brief returns variants with default limits, with every limit set at start of pattern and without limits
+std::vector<redos_variant> get_redos_variants() {
+	constexpr uint32_t unlimited   = std::numeric_limits<uint32_t>::max();
+	constexpr uint32_t match_limit = 100'000;
+
+	std::vector<redos_variant> variants = {
+		{ "pcre2cpp", "", false, false, 0 },
+		{ "pcre2cpp_limit_match", "(*LIMIT_MATCH=100000)", false, false, 0 },
+		{ "pcre2cpp_limit_depth", "(*LIMIT_DEPTH=1000)", false, false, 0 },
+		// heap limit is in KiB
+		{ "pcre2cpp_limit_heap", "(*LIMIT_HEAP=64)", false, false, 0 },
+		{ "pcre2_unlimited", "", true, false, unlimited },
+	};
+
+	uint32_t has_jit = 0;
+	pcre2_config_8(PCRE2_CONFIG_JIT, &has_jit);
+		if (has_jit != 0) {
+			variants.push_back({ "pcre2_jit", "", true, true, unlimited });
+			variants.push_back({ "pcre2_jit_limit_match", "", true, true, match_limit });
+		}
+		else { std::fputs("PCRE2 is built without JIT, JIT variants are skipped\n", stderr); }
+	return variants;
+}
+
+#pragma endregion
+
+/**
+ * @brief measures match of subject with variant and sets outcome to pcre2 match code
+ * @return measured result or nullptr when benchmark isn't selected
+ */
+const bench::result* run_variant(bench::suite& suite, const std::string& group, const std::string& name,
+  const redos_variant& variant, const pcre2cpp::regex& re, const limited_regex& raw_re, const std::string& subject,
+  int& code) {
+		if (!suite.is_selected(group + "/" + name + "/" + variant.name)) { return nullptr; }
+
+		if (variant.is_pcre2) {
+			code = raw_re.match(subject);
+			return suite.run(group, name, variant.name, subject.size(),
+			  [&]() { bench::do_not_optimize(raw_re.match(subject)); });
+		}
+
+	pcre2cpp::match_result result;
+	re.match(subject, result);
+	code = static_cast<int>(result.get_error_code());
+	return suite.run(group, name, variant.name, subject.size(), [&]() { bench::do_not_optimize(re.match(subject)); });
+}
+
+bool run_redos(bench::suite& suite, const double budget) {
+	bool is_valid = true;
+		for (const redos_case& redos : get_redos_cases()) {
+			const std::string group = "redos_" + redos.name;
+
+				for (const redos_variant& variant : get_redos_variants()) {
+					const pcre2cpp::regex re(variant.prefix + redos.pattern);
+					const limited_regex raw_re(redos.pattern, variant.jit, variant.match_limit);
+
+					bench::growth_curve curve;
+					curve.name = group + "/" + variant.name;
+						for (const size_t size : redos.sizes) {
+							const std::string name	  = "n" + std::to_string(size);
+							const std::string subject = make_redos_subject(redos, size);
+							int code				  = 0;
+							const bench::result* res  = run_variant(suite, group, name, variant, re, raw_re, subject, code);
+								if (res == nullptr) { continue; }
+
+								if (code >= 0) {
+									std::fprintf(stderr, "[[MISMATCH]] %s/%s: %s found match in subject which shouldn't match\n",
+									  group.c_str(), name.c_str(), variant.name.c_str());
+									is_valid = false;
+								}
+
+							curve.sizes.push_back(size);
+							curve.ns_per_op.push_back(res->ns_per_op);
+							curve.outcomes.push_back(outcome_name(code));
+								if (res->ns_per_op > budget * 1e9) { break; }
+						}
+					suite.add_curve(std::move(curve));
+				}
+		}
+	return is_valid;
+}
+
+bool run_corpus(bench::suite& suite, const std::string& directory) {
+	std::error_code error;
+	std::vector<std::filesystem::path> paths;
+		for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+				if (entry.is_regular_file()) { paths.push_back(entry.path()); }
+		}
+		if (error) {
+			std::fprintf(stderr, "Can't read corpus %s\n", directory.c_str());
+			return false;
+		}
+	std::sort(paths.begin(), paths.end());
+
+	bool is_valid = true;
+		for (const std::filesystem::path& path : paths) {
+			// pattern is in the first line and subject is the rest of file
+			std::ifstream in(path, std::ios::binary);
+			const std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+			const size_t end			= content.find('\n');
+			const std::string pattern	= content.substr(0, end);
+			const std::string subject	= end == std::string::npos ? std::string() : content.substr(end + 1);
+				if (!pcre2cpp::is_pattern_valid(pattern)) {
+					std::fprintf(stderr, "Invalid pattern in %s\n", path.string().c_str());
+					is_valid = false;
+					continue;
+				}
+
+				for (const redos_variant& variant : get_redos_variants()) {
+					const pcre2cpp::regex re(variant.prefix + pattern);
+					const limited_regex raw_re(pattern, variant.jit, variant.match_limit);
+
+					int code = 0;
+					run_variant(suite, "corpus", path.stem().string(), variant, re, raw_re, subject, code);
+				}
+		}
+	return is_valid;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef _PCRE2CPP_BENCHMARK_REDOS_HPP_
+	#define _PCRE2CPP_BENCHMARK_REDOS_HPP_
+
+	#include <benchmark.hpp>
+	#include <string>
+	#include <vector>
+
+/// @brief catastrophic pattern with subject on which it fails slowly
+struct redos_case {
+	std::string name;
+	std::string pattern;
+	/// @brief repeated part of subject
+	std::string unit;
+	/// @brief end of subject which makes match fail
+	std::string suffix;
+	/// @brief counts of repetitions of unit
+	std::vector<size_t> sizes;
+};
+
+/// @brief returns known catastrophic pattern and subject pairs
+const std::vector<redos_case>& get_redos_cases();
+
+/// @brief returns subject of case with unit repeated size times
+std::string make_redos_subject(const redos_case& redos, size_t size);
+
+/**
+ * @brief measures time to failure of catastrophic cases swept across sizes with and without match, depth and heap
+ * limits and with JIT on and off, adds growth curve of every case and variant to suite
+ * @param suite suite which collects results
+ * @param budget time of one operation in seconds after which sweep of variant stops
+ * @return false when some variant found match in subject which shouldn't match
+ */
+bool run_redos(bench::suite& suite, double budget);
+
+/**
+ * @brief measures every pattern and subject of corpus written by pcre2cpp-fuzz with the same variants as run_redos
+ * (files contain pattern, new line and subject)
+ * @param suite suite which collects results
+ * @param directory directory of corpus
+ * @return false when corpus can't be read or it contains invalid pattern
+ */
+bool run_corpus(bench::suite& suite, const std::string& directory);
+
+#endif
@@ -0,0 +1,49 @@
+#include <new_delete_counter.hpp>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	thread_local new_delete_counter::new_stats counted;
+} // namespace
+
+namespace new_delete_counter {
+	new_stats get_thread_stats() noexcept { return counted; }
+} // namespace new_delete_counter
+
+#pragma region GLOBAL_NEW_DELETE
+
+void* operator new(const size_t size) {
+	++counted.allocations;
+	counted.bytes += size;
+
+	void* ptr	   = std::malloc(size != 0 ? size : 1);
+		if (ptr == nullptr) { throw std::bad_alloc(); }
+	return ptr;
+}
+
+void* operator new[](const size_t size) { return operator new(size); }
+
+// nothrow versions are replaced too, so every allocation is counted and freed by std::free
+void* operator new(const size_t size, const std::nothrow_t&) noexcept {
+	try {
+		return operator new(size);
+	} catch (...) {
+		return nullptr;
+	}
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept { return operator new(size, std::nothrow); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+#pragma endregion
@@ -0,0 +1,21 @@
+#pragma once
+#ifndef _PCRE2CPP_NEW_DELETE_COUNTER_HPP_
+	#define _PCRE2CPP_NEW_DELETE_COUNTER_HPP_
+
+	#include <cstddef>
+
+namespace new_delete_counter {
+	/// @brief global operator new calls of one thread
+	struct new_stats {
+		/// @brief count of global operator new calls
+		size_t allocations = 0;
+		/// @brief bytes requested by global operator new
+		size_t bytes	   = 0;
+	};
+
+	/// @brief returns global operator new calls made by current thread since its start (operators are replaced by
+	/// new_delete_counter.cpp, which is compiled into tests and benchmark)
+	new_stats get_thread_stats() noexcept;
+} // namespace new_delete_counter
+
+#endif
@@ -0,0 +1,506 @@
+#include <pch.hpp>
+
+#pragma region JSON
+
+/// @brief parsed JSON value
+struct json_value {
+	enum class type : uint8_t { Null, Bool, Number, String, Array, Object };
+
+	type kind	  = type::Null;
+	bool boolean  = false;
+	double number = 0.0;
+	std::string string;
+	/// @brief elements of array or values of object
+	std::vector<json_value> values;
+	/// @brief keys of object (in the same order as values)
+	std::vector<std::string> keys;
+
+	/// @brief returns member of object with key or nullptr when it doesn't exist
+	const json_value* find(const std::string_view key) const {
+			for (size_t i = 0; i != keys.size(); ++i) {
+					if (keys[i] == key) { return &values[i]; }
+			}
+		return nullptr;
+	}
+
+	/// @brief returns number of member with key or default value when it isn't number
+	double get_number(const std::string_view key, const double default_value = 0.0) const {
+		const json_value* value = find(key);
+		return value != nullptr && value->kind == type::Number ? value->number : default_value;
+	}
+};
+
+/// @brief recursive descent JSON parser (for output of pcre2cpp-benchmark --json)
+class json_parser {
+private:
+	std::string_view _text;
+	size_t _pos = 0;
+
+	void _skip_spaces() {
+			while (_pos != _text.size() && std::isspace(static_cast<unsigned char>(_text[_pos]))) { ++_pos; }
+	}
+
+	bool _consume(const char c) {
+		_skip_spaces();
+			if (_pos == _text.size() || _text[_pos] != c) { return false; }
+		++_pos;
+		return true;
+	}
+
+	/// @brief appends code point of \u escape as UTF-8 (surrogate pairs aren't joined)
+	static void _append_utf8(std::string& out, const unsigned long code) {
+			if (code < 0x80) { out += static_cast<char>(code); }
+			else if (code < 0x800) {
+				out += static_cast<char>(0xC0 | (code >> 6));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+			else {
+				out += static_cast<char>(0xE0 | (code >> 12));
+				out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+	}
+
+	bool _parse_string(std::string& out) {
+			if (!_consume('"')) { return false; }
+
+			while (_pos != _text.size() && _text[_pos] != '"') {
+				const char c = _text[_pos++];
+					if (c != '\\') {
+						out += c;
+						continue;
+					}
+					if (_pos == _text.size()) { return false; }
+
+					switch (_text[_pos++]) {
+						case 'n': out += '\n'; break;
+						case 't': out += '\t'; break;
+						case 'r': out += '\r'; break;
+						case 'b': out += '\b'; break;
+						case 'f': out += '\f'; break;
+						case 'u':
+								if (_pos + 4 > _text.size()) { return false; }
+							_append_utf8(out, std::strtoul(std::string(_text.substr(_pos, 4)).c_str(), nullptr, 16));
+							_pos += 4;
+							break;
+						default: out += _text[_pos - 1]; break;
+					}
+			}
+			if (_pos == _text.size()) { return false; }
+		++_pos;
+		return true;
+	}
+
+	bool _parse_number(double& out) {
+		const size_t start = _pos;
+			while (_pos != _text.size() && (std::isdigit(static_cast<unsigned char>(_text[_pos])) ||
+											   std::string_view("+-.eE").find(_text[_pos]) != std::string_view::npos)) {
+				++_pos;
+			}
+			if (start == _pos) { return false; }
+
+		const std::string number(_text.substr(start, _pos - start));
+		char* end = nullptr;
+		out		  = std::strtod(number.c_str(), &end);
+		return end == number.c_str() + number.size();
+	}
+
+	bool _parse_literal(const std::string_view literal) {
+			if (_text.substr(_pos, literal.size()) != literal) { return false; }
+		_pos += literal.size();
+		return true;
+	}
+
+	bool _parse_value(json_value& value) {
+		_skip_spaces();
+			if (_pos == _text.size()) { return false; }
+
+			switch (_text[_pos]) {
+				case '{':
+					++_pos;
+					value.kind = json_value::type::Object;
+						if (_consume('}')) { return true; }
+						do {
+							value.keys.emplace_back();
+							value.values.emplace_back();
+								if (!_parse_string(value.keys.back()) || !_consume(':') || !_parse_value(value.values.back())) {
+									return false;
+								}
+						} while (_consume(','));
+					return _consume('}');
+				case '[':
+					++_pos;
+					value.kind = json_value::type::Array;
+						if (_consume(']')) { return true; }
+						do {
+							value.values.emplace_back();
+								if (!_parse_value(value.values.back())) { return false; }
+						} while (_consume(','));
+					return _consume(']');
+				case '"':
+					value.kind = json_value::type::String;
+					return _parse_string(value.string);
+				case 't':
+					value.kind	  = json_value::type::Bool;
+					value.boolean = true;
+					return _parse_literal("true");
+				case 'f':
+					value.kind = json_value::type::Bool;
+					return _parse_literal("false");
+				case 'n': return _parse_literal("null");
+				default:
+					value.kind = json_value::type::Number;
+					return _parse_number(value.number);
+			}
+	}
+
+public:
+	explicit json_parser(const std::string_view text) : _text(text) {}
+
+	/// @brief parses whole text, returns false when it isn't valid JSON
+	bool parse(json_value& value) {
+		_pos = 0;
+			if (!_parse_value(value)) { return false; }
+		_skip_spaces();
+		return _pos == _text.size();
+	}
+};
+
+#pragma endregion
+
+#pragma region STATISTICS
+
+/// @brief latency of benchmark summarized by mean and standard deviation of its samples
+struct measurement {
+	double mean	   = 0.0;
+	double stddev  = 0.0;
+	size_t samples = 0;
+
+	/**
+	 * @brief merges other run of the same benchmark. Variance of merged samples includes differences between means of
+	 * runs, so noise between runs widens confidence interval
+	 */
+	void merge(const measurement& other) {
+			if (samples == 0) {
+				*this = other;
+				return;
+			}
+
+		const double count_a	 = static_cast<double>(samples);
+		const double count_b	 = static_cast<double>(other.samples);
+		const double count		 = count_a + count_b;
+		const double merged_mean = (count_a * mean + count_b * other.mean) / count;
+		const double squares	 = (count_a - 1.0) * stddev * stddev + (count_b - 1.0) * other.stddev * other.stddev +
+							   count_a * (mean - merged_mean) * (mean - merged_mean) +
+							   count_b * (other.mean - merged_mean) * (other.mean - merged_mean);
+
+		mean	 = merged_mean;
+		stddev	 = std::sqrt(squares / (count - 1.0));
+		samples += other.samples;
+	}
+};
+
+/// @brief logarithm of mean with variance of its estimate (delta method) and degrees of freedom of that variance
+struct log_term {
+	double value	= 0.0;
+	double variance = 0.0;
+	double df		= 0.0;
+
+	explicit log_term(const measurement& m)
+		: value(std::log(std::max(m.mean, std::numeric_limits<double>::min()))),
+		  variance(m.mean > 0.0 ? m.stddev * m.stddev / (m.mean * m.mean * static_cast<double>(m.samples)) : 0.0),
+		  df(static_cast<double>(m.samples) - 1.0) {}
+};
+
+/// @brief returns continued fraction of regularized incomplete beta function (modified Lentz's method)
+double beta_fraction(const double a, const double b, const double x) {
+	constexpr double tiny = 1e-300;
+	const auto clamp	  = [](const double value) { return std::abs(value) < tiny ? tiny : value; };
+
+	double c	  = 1.0;
+	double d	  = 1.0 / clamp(1.0 - (a + b) * x / (a + 1.0));
+	double result = d;
+		for (int m = 1; m != 500; ++m) {
+			const double step = 2.0 * m;
+
+			double coefficient = m * (b - m) * x / ((a + step - 1.0) * (a + step));
+			d				   = 1.0 / clamp(1.0 + coefficient * d);
+			c				   = clamp(1.0 + coefficient / c);
+			result			   *= d * c;
+
+			coefficient		   = -(a + m) * (a + b + m) * x / ((a + step) * (a + step + 1.0));
+			d				   = 1.0 / clamp(1.0 + coefficient * d);
+			c				   = clamp(1.0 + coefficient / c);
+			const double delta = d * c;
+			result			   *= delta;
+				if (std::abs(delta - 1.0) < 1e-12) { break; }
+		}
+	return result;
+}
+
+/// @brief returns regularized incomplete beta function I_x(a, b)
+double incomplete_beta(const double a, const double b, const double x) {
+		if (x <= 0.0) { return 0.0; }
+		if (x >= 1.0) { return 1.0; }
+
+	const double front =
+	  std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log1p(-x));
+		if (x < (a + 1.0) / (a + b + 2.0)) { return front * beta_fraction(a, b, x) / a; }
+	return 1.0 - front * beta_fraction(b, a, 1.0 - x) / b;
+}
+
+/// @brief returns probability of |T| >= t for Student's t distribution (normal distribution when df is infinite)
+double two_sided_p(const double t, const double df) {
+		if (std::isinf(df)) { return std::erfc(std::abs(t) / std::sqrt(2.0)); }
+	return incomplete_beta(df / 2.0, 0.5, df / (df + t * t));
+}
+
+/// @brief returns t for which two sided p is 1 - confidence (found by bisection)
+double critical_t(const double confidence, const double df) {
+	double low	= 0.0;
+	double high = 1e3;
+		for (int i = 0; i != 100; ++i) {
+			const double mid = (low + high) / 2.0;
+				if (two_sided_p(mid, df) > 1.0 - confidence) { low = mid; }
+				else { high = mid; }
+		}
+	return high;
+}
+
+/// @brief relative change of latency with its confidence interval and p-value of Welch's t-test
+struct change_estimate {
+	double change  = 0.0;
+	double low	   = 0.0;
+	double high	   = 0.0;
+	double p_value = 1.0;
+};
+
+/**
+ * @brief estimates exp(sum of added - sum of subtracted) - 1 in log space. Variances of terms are added and degrees of
+ * freedom are approximated by Welch-Satterthwaite equation (for one term on each side it is Welch's t-test on ratio
+ * of means)
+ */
+change_estimate estimate_change(const std::vector<log_term>& added, const std::vector<log_term>& subtracted,
+  const double confidence) {
+	double estimate	   = 0.0;
+	double variance	   = 0.0;
+	double df_divisor  = 0.0;
+	const auto add_term = [&](const log_term& term, const double sign) {
+		estimate += sign * term.value;
+		variance += term.variance;
+			if (term.df > 0.0) { df_divisor += term.variance * term.variance / term.df; }
+	};
+		for (const log_term& term : added) { add_term(term, 1.0); }
+		for (const log_term& term : subtracted) { add_term(term, -1.0); }
+
+	change_estimate result;
+	result.change = std::expm1(estimate);
+		if (variance == 0.0) {
+			// single samples without deviation, every difference is taken as significant
+			result.low	   = result.change;
+			result.high	   = result.change;
+			result.p_value = estimate == 0.0 ? 1.0 : 0.0;
+			return result;
+		}
+
+	const double df		  = df_divisor > 0.0 ? variance * variance / df_divisor : std::numeric_limits<double>::infinity();
+	const double error	  = std::sqrt(variance);
+	const double margin	  = critical_t(confidence, df) * error;
+	result.low			  = std::expm1(estimate - margin);
+	result.high			  = std::expm1(estimate + margin);
+	result.p_value		  = two_sided_p(estimate / error, df);
+	return result;
+}
+
+#pragma endregion
+
+#pragma region COMPARISON
+
+/// @brief options of comparison (set from command line)
+struct compare_options {
+	/// @brief JSON files of baseline runs (runs of the same benchmark are merged)
+	std::vector<std::string> baseline_paths;
+	/// @brief JSON files of current runs (runs of the same benchmark are merged)
+	std::vector<std::string> current_paths;
+	/// @brief only benchmarks which name contains filter are compared
+	std::string filter;
+	/// @brief library to which latency is normalized (empty when absolute latency is compared)
+	std::string relative;
+	/// @brief slowdown in percent above which significant change is regression
+	double threshold  = 5.0;
+	/// @brief confidence level of intervals and significance
+	double confidence = 0.95;
+};
+
+/// @brief reads benchmarks of JSON file written by pcre2cpp-benchmark --json and merges them to results by name
+bool load_results(const std::string& path, std::map<std::string, measurement>& results) {
+	std::ifstream in(path, std::ios::binary);
+		if (!in) {
+			std::fprintf(stderr, "Can't read %s\n", path.c_str());
+			return false;
+		}
+	const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	json_value root;
+	const json_value* benchmarks = nullptr;
+		if (json_parser(text).parse(root)) { benchmarks = root.find("benchmarks"); }
+		if (benchmarks == nullptr || benchmarks->kind != json_value::type::Array) {
+			std::fprintf(stderr, "%s isn't JSON written by pcre2cpp-benchmark --json\n", path.c_str());
+			return false;
+		}
+
+		for (const json_value& benchmark : benchmarks->values) {
+			const json_value* name = benchmark.find("name");
+				if (name == nullptr || name->kind != json_value::type::String) { continue; }
+
+			measurement m;
+			m.mean	  = benchmark.get_number("ns_per_op");
+			m.stddev  = benchmark.get_number("stddev_ns");
+			m.samples = static_cast<size_t>(std::max(benchmark.get_number("samples", 1.0), 1.0));
+			results[name->string].merge(m);
+		}
+	return true;
+}
+
+/// @brief returns name of the same group and subject measured with other library (name is group/subject/library)
+std::string with_library(const std::string& name, const std::string& library) {
+	return name.substr(0, name.rfind('/') + 1) + library;
+}
+
+/**
+ * @brief compares every benchmark of both runs and prints change of latency (or of latency relative to other library)
+ * @return count of regressions
+ */
+size_t compare(const compare_options& options, const std::map<std::string, measurement>& baseline,
+  const std::map<std::string, measurement>& current) {
+	const bool is_relative = !options.relative.empty();
+	const double threshold = options.threshold / 100.0;
+
+	size_t compared		= 0;
+	size_t regressions	= 0;
+	size_t improvements = 0;
+	size_t missing		= 0;
+		for (const auto& [name, cur] : current) {
+				if (!options.filter.empty() && name.find(options.filter) == std::string::npos) { continue; }
+				if (is_relative && with_library(name, options.relative) == name) { continue; }
+
+			const auto base = baseline.find(name);
+				if (base == baseline.end()) {
+					std::printf("[[MISSING]] %s isn't in baseline\n", name.c_str());
+					++missing;
+					continue;
+				}
+
+			std::vector<log_term> added		 = { log_term(cur) };
+			std::vector<log_term> subtracted = { log_term(base->second) };
+			double base_value				 = base->second.mean;
+			double cur_value				 = cur.mean;
+				if (is_relative) {
+					const std::string reference_name = with_library(name, options.relative);
+					const auto base_reference		 = baseline.find(reference_name);
+					const auto cur_reference		 = current.find(reference_name);
+						if (base_reference == baseline.end() || cur_reference == current.end()) {
+							std::printf("[[MISSING]] %s isn't in both runs\n", reference_name.c_str());
+							++missing;
+							continue;
+						}
+
+					added.emplace_back(base_reference->second);
+					subtracted.emplace_back(cur_reference->second);
+					base_value /= base_reference->second.mean;
+					cur_value  /= cur_reference->second.mean;
+				}
+
+			const change_estimate estimate = estimate_change(added, subtracted, options.confidence);
+			const bool is_significant	   = estimate.low > 0.0 || estimate.high < 0.0;
+			const char* status			   = "same";
+				if (is_significant && estimate.change > threshold) {
+					status = "REGRESSION";
+					++regressions;
+				}
+				else if (is_significant && estimate.change < -threshold) {
+					status = "improvement";
+					++improvements;
+				}
+				else if (std::abs(estimate.change) > threshold) { status = "noise"; }
+			++compared;
+
+			std::printf("[[COMPARE]] %-60s %12.4g -> %12.4g %s %+8.2f%% [%+8.2f%%, %+8.2f%%] p %.4f %s\n", name.c_str(),
+			  base_value, cur_value, is_relative ? "x" : "ns/op", estimate.change * 100.0, estimate.low * 100.0,
+			  estimate.high * 100.0, estimate.p_value, status);
+		}
+		for (const auto& [name, base] : baseline) {
+				if (!options.filter.empty() && name.find(options.filter) == std::string::npos) { continue; }
+				if (current.find(name) == current.end()) {
+					std::printf("[[MISSING]] %s isn't in current run\n", name.c_str());
+					++missing;
+				}
+		}
+
+	std::printf("\n%zu compared, %zu regressions, %zu improvements, %zu missing (threshold %.2f%%, confidence %.1f%%)\n",
+	  compared, regressions, improvements, missing, options.threshold, options.confidence * 100.0);
+	return regressions;
+}
+
+#pragma endregion
+
+void print_usage() {
+	std::fputs("Usage: pcre2cpp-benchmark-compare [--threshold PERCENT] [--confidence LEVEL] [--relative LIBRARY]\n"
+			   "                                  [--filter TEXT] [--baseline FILE] [--current FILE] [BASELINE CURRENT]\n"
+			   "  --threshold PERCENT  slowdown above which significant change is regression (default: 5)\n"
+			   "  --confidence LEVEL   confidence level of intervals and significance (default: 0.95)\n"
+			   "  --relative LIBRARY   compares latency relative to LIBRARY of the same group and subject (e.g. pcre2)\n"
+			   "  --filter TEXT        compares only benchmarks which name (group/subject/library) contains TEXT\n"
+			   "  --baseline FILE      adds run of baseline (repeated runs are merged)\n"
+			   "  --current FILE       adds run of current version (repeated runs are merged)\n"
+			   "Exits with 1 when some benchmark is significantly slower by more than threshold, 2 on invalid input\n",
+	  stderr);
+}
+
+/// @brief parses arguments, returns false when they are invalid
+bool parse_options(const int argc, char** argv, compare_options& options) {
+	std::vector<std::string> positional;
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view arg = argv[i];
+				if (arg.substr(0, 2) != "--") {
+					positional.emplace_back(arg);
+					continue;
+				}
+				if (i + 1 >= argc) { return false; }
+
+				if (arg == "--threshold") { options.threshold = std::strtod(argv[++i], nullptr); }
+				else if (arg == "--confidence") { options.confidence = std::strtod(argv[++i], nullptr); }
+				else if (arg == "--relative") { options.relative = argv[++i]; }
+				else if (arg == "--filter") { options.filter = argv[++i]; }
+				else if (arg == "--baseline") { options.baseline_paths.emplace_back(argv[++i]); }
+				else if (arg == "--current") { options.current_paths.emplace_back(argv[++i]); }
+				else { return false; }
+		}
+
+		if (positional.size() == 2) {
+			options.baseline_paths.push_back(positional[0]);
+			options.current_paths.push_back(positional[1]);
+		}
+		else if (!positional.empty()) { return false; }
+	return !options.baseline_paths.empty() && !options.current_paths.empty() && options.threshold >= 0.0 &&
+		   options.confidence > 0.0 && options.confidence < 1.0;
+}
+
+int main(const int argc, char** argv) {
+	compare_options options;
+		if (!parse_options(argc, argv, options)) {
+			print_usage();
+			return 2;
+		}
+
+	std::map<std::string, measurement> baseline;
+	std::map<std::string, measurement> current;
+		for (const std::string& path : options.baseline_paths) {
+				if (!load_results(path, baseline)) { return 2; }
+		}
+		for (const std::string& path : options.current_paths) {
+				if (!load_results(path, current)) { return 2; }
+		}
+
+	return compare(options, baseline, current) == 0 ? 0 : 1;
+}
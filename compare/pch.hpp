@@ -0,0 +1,20 @@
+#pragma once
+#ifndef _PCRE2CPP_COMPARE_PCH_HPP_
+	#define _PCRE2CPP_COMPARE_PCH_HPP_
+
+	#include <algorithm>
+	#include <cctype>
+	#include <cmath>
+	#include <cstdint>
+	#include <cstdio>
+	#include <cstdlib>
+	#include <fstream>
+	#include <iterator>
+	#include <limits>
+	#include <map>
+	#include <string>
+	#include <string_view>
+	#include <utility>
+	#include <vector>
+
+#endif
@@ -0,0 +1,330 @@
+#include <pch.hpp>
+
+#pragma region FUZZER
+
+/// @brief subject with count of steps (items of pattern entered by pcre2) of its match
+struct scored_input {
+	std::string subject;
+	size_t steps	  = 0;
+	/// @brief match was stopped by match limit
+	bool limit_reached = false;
+};
+
+/// @brief returns FNV-1a hash of text (names corpus files of pattern)
+uint64_t hash_text(const std::string_view text) {
+	uint64_t hash = 14695981039346656037ull;
+		for (const char c : text) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+	return hash;
+}
+
+/**
+ * @brief Searches subjects which make pcre2 do the most steps on one pattern and keeps the worst of them. Steps are
+ * counted by regex_profiler (automatic callouts before every item of pattern), and match is limited by
+ * (*LIMIT_MATCH) so catastrophic subject ends the search instead of hanging it
+ */
+class slow_input_fuzzer {
+private:
+	std::string _pattern;
+	pcre2cpp::regex_profiler _profiler;
+	/// @brief characters inserted by mutations (characters of pattern and common ones)
+	std::string _alphabet;
+	size_t _max_size;
+	size_t _keep;
+	/// @brief the worst inputs sorted by steps (descending)
+	std::vector<scored_input> _worst;
+	std::mt19937_64 _rng;
+
+	/// @brief returns printable characters of pattern and characters which often end or break matches
+	static std::string _make_alphabet(const std::string_view pattern) {
+		std::string alphabet = "aA0 _-.!\n";
+			for (const char c : pattern) {
+					if (c >= 0x20 && c < 0x7f && alphabet.find(c) == std::string::npos) { alphabet += c; }
+			}
+		return alphabet;
+	}
+
+	char _random_char() {
+			// sometimes any byte, so characters outside of pattern are also tried
+			if (_rng() % 16 == 0) { return static_cast<char>(_rng() % 256); }
+		return _alphabet[_rng() % _alphabet.size()];
+	}
+
+	/// @brief returns subject changed by 1 to 3 random mutations
+	std::string _mutate(std::string subject) {
+		const size_t count = 1 + _rng() % 3;
+			for (size_t i = 0; i != count; ++i) {
+				const size_t pos = subject.empty() ? 0 : _rng() % (subject.size() + 1);
+					switch (_rng() % 6) {
+						case 0: subject.insert(pos, 1, _random_char()); break;
+						case 1:
+								if (pos < subject.size()) { subject.erase(pos, 1); }
+							break;
+						case 2:
+								if (pos < subject.size()) { subject[pos] = _random_char(); }
+							break;
+						case 3: {
+							// repeated parts make nested quantifiers and alternations backtrack
+							const std::string part = pos < subject.size() ? subject.substr(pos, 1 + _rng() % 8) : std::string();
+							subject.insert(pos, part);
+							break;
+						}
+						case 4: subject.append(1 + _rng() % 8, _random_char()); break;
+						default: {
+								if (_worst.empty()) { break; }
+							const std::string& other = _worst[_rng() % _worst.size()].subject;
+							const size_t start		 = other.empty() ? 0 : _rng() % other.size();
+							subject.insert(pos, other.substr(start, 1 + _rng() % 8));
+							break;
+						}
+					}
+			}
+			if (subject.size() > _max_size) { subject.resize(_max_size); }
+		return subject;
+	}
+
+public:
+	/**
+	 * @param pattern fuzzed pattern (it has to be valid)
+	 * @param match_limit match limit of one match
+	 * @param max_size maximal size of subject
+	 * @param keep count of kept worst inputs
+	 * @param seed seed of random mutations
+	 */
+	slow_input_fuzzer(const std::string_view pattern, const uint32_t match_limit, const size_t max_size, const size_t keep,
+	  const uint64_t seed)
+		: _pattern(pattern), _profiler("(*LIMIT_MATCH=" + std::to_string(match_limit) + ")" + std::string(pattern)),
+		  _alphabet(_make_alphabet(pattern)), _max_size(max_size), _keep(std::max<size_t>(keep, 1)), _rng(seed) {}
+
+	slow_input_fuzzer(const slow_input_fuzzer&)			   = delete;
+	slow_input_fuzzer& operator=(const slow_input_fuzzer&) = delete;
+
+	/// @brief returns fuzzed pattern
+	const std::string& get_pattern() const noexcept { return _pattern; }
+
+	/// @brief returns maximal size of subject
+	size_t get_max_size() const noexcept { return _max_size; }
+
+	/// @brief returns the worst inputs sorted by steps (descending)
+	const std::vector<scored_input>& get_worst() const noexcept { return _worst; }
+
+	/// @brief matches subject once and returns its steps
+	scored_input measure(const std::string_view subject) {
+		_profiler.reset();
+		_profiler.match(subject);
+
+		const pcre2cpp::regex_profile profile = _profiler.get_profile();
+		return scored_input { std::string(subject), profile.entered, profile.limit_errors != 0 };
+	}
+
+	/// @brief keeps input when it is one of the worst, returns true when it became the worst one
+	bool add(scored_input input) {
+			if (_worst.size() == _keep && input.steps <= _worst.back().steps) { return false; }
+			if (std::any_of(_worst.begin(), _worst.end(),
+				  [&](const scored_input& kept) { return kept.subject == input.subject; })) {
+				return false;
+			}
+
+		const auto it = std::upper_bound(_worst.begin(), _worst.end(), input,
+		  [](const scored_input& a, const scored_input& b) { return a.steps > b.steps; });
+		const bool is_worst = it == _worst.begin();
+		_worst.insert(it, std::move(input));
+			if (_worst.size() > _keep) { _worst.pop_back(); }
+		return is_worst;
+	}
+
+	/// @brief mutates the worst inputs, stops after iterations or when subject reaches match limit
+	void run(const size_t iterations) {
+		add(measure(""));
+		add(measure(_alphabet.substr(0, std::min(_alphabet.size(), _max_size))));
+			for (const char c : _alphabet) { add(measure(std::string(std::min<size_t>(_max_size, 16), c))); }
+
+			for (size_t i = 0; i != iterations && !_worst.front().limit_reached; ++i) {
+				const std::string& parent = _worst[_rng() % _worst.size()].subject;
+					if (add(measure(_mutate(parent)))) {
+						std::printf("[[FUZZ]] %016llx iteration %zu: %zu steps, %zu bytes%s\n",
+						  static_cast<unsigned long long>(hash_text(_pattern)), i, _worst.front().steps,
+						  _worst.front().subject.size(), _worst.front().limit_reached ? " (match limit)" : "");
+						std::fflush(stdout);
+					}
+			}
+	}
+
+	/**
+	 * @brief writes the worst inputs to directory as corpus replayed by pcre2cpp-benchmark --corpus. Every file is
+	 * named <hash of pattern>_<rank>.txt and contains pattern, new line and subject
+	 */
+	bool save(const std::string& directory) const {
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+
+		char prefix[32];
+		std::snprintf(prefix, sizeof(prefix), "%016llx", static_cast<unsigned long long>(hash_text(_pattern)));
+			for (size_t i = 0; i != _worst.size(); ++i) {
+				const std::filesystem::path path =
+				  std::filesystem::path(directory) / (std::string(prefix) + "_" + std::to_string(i) + ".txt");
+				std::ofstream out(path, std::ios::binary);
+				out << _pattern << '\n' << _worst[i].subject;
+					if (!out) { return false; }
+			}
+		return true;
+	}
+};
+
+#pragma endregion
+
+#ifdef PCRE2CPP_FUZZ_LIBFUZZER
+	#pragma region LIBFUZZER
+
+namespace {
+	std::unique_ptr<slow_input_fuzzer> fuzzer;
+	std::string corpus_directory;
+
+	/// @brief function with own coverage for every bucket of steps, so libFuzzer keeps inputs which need more steps
+	template<size_t Bucket>
+	void reach_bucket() {
+		static volatile size_t count = 0;
+		count						 = count + 1;
+	}
+
+	template<size_t... Buckets>
+	void reach_bucket(const size_t bucket, std::index_sequence<Buckets...>) {
+		using bucket_func						   = void (*)();
+		static constexpr bucket_func buckets[] = { &reach_bucket<Buckets>... };
+		buckets[std::min(bucket, sizeof...(Buckets) - 1)]();
+	}
+} // namespace
+
+/// @brief reads fuzzed pattern from PCRE2CPP_FUZZ_PATTERN and corpus directory from PCRE2CPP_FUZZ_CORPUS
+extern "C" int LLVMFuzzerInitialize(int*, char***) {
+	const char* pattern = std::getenv("PCRE2CPP_FUZZ_PATTERN");
+		if (pattern == nullptr || !pcre2cpp::is_pattern_valid(pattern)) {
+			std::fputs("PCRE2CPP_FUZZ_PATTERN has to be set to valid pattern\n", stderr);
+			std::exit(2);
+		}
+
+	const char* corpus = std::getenv("PCRE2CPP_FUZZ_CORPUS");
+	corpus_directory   = corpus != nullptr ? corpus : "";
+	fuzzer			   = std::make_unique<slow_input_fuzzer>(pattern, 10'000'000, 4096, 8, 0);
+	return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, const size_t size) {
+	const std::string_view subject(reinterpret_cast<const char*>(data), std::min(size, fuzzer->get_max_size()));
+	scored_input input = fuzzer->measure(subject);
+
+	// log2 of steps
+	size_t bucket	   = 0;
+		for (size_t steps = input.steps; steps > 1; steps >>= 1) { ++bucket; }
+	reach_bucket(bucket, std::make_index_sequence<32>());
+
+		if (fuzzer->add(std::move(input))) {
+			std::printf("[[FUZZ]] %zu steps, %zu bytes\n", fuzzer->get_worst().front().steps, subject.size());
+				if (!corpus_directory.empty()) { fuzzer->save(corpus_directory); }
+		}
+	return 0;
+}
+
+	#pragma endregion
+#else
+	#pragma region DRIVER
+
+/// @brief command line options
+struct fuzz_options {
+	std::vector<std::string> patterns;
+	std::string corpus;
+	size_t iterations	 = 20'000;
+	size_t max_size		 = 64;
+	size_t keep			 = 4;
+	uint32_t match_limit = 1'000'000;
+	uint64_t seed		 = 1;
+};
+
+void print_usage() {
+	std::fputs("Usage: pcre2cpp-fuzz (--pattern PATTERN | --patterns FILE)... [OPTIONS]\n"
+			   "Mutates subjects to find the ones which make pcre2 do the most steps on every pattern.\n\n"
+			   "  --pattern PATTERN     fuzzed pattern\n"
+			   "  --patterns FILE       file with one fuzzed pattern per line (empty lines and lines with # are skipped)\n"
+			   "  --iterations N        count of mutations of every pattern (default: 20000)\n"
+			   "  --max-size BYTES      maximal size of subject (default: 64)\n"
+			   "  --keep N              count of kept worst subjects of every pattern (default: 4)\n"
+			   "  --match-limit N       match limit of one match, reaching it ends pattern (default: 1000000)\n"
+			   "  --seed N              seed of random mutations (default: 1)\n"
+			   "  --corpus DIR          writes the worst subjects to DIR (replayed by pcre2cpp-benchmark --corpus DIR)\n",
+	  stderr);
+}
+
+/// @brief reads patterns from file, returns false when it can't be read
+bool read_patterns(const std::string& path, std::vector<std::string>& patterns) {
+	std::ifstream in(path);
+		if (!in) { return false; }
+
+	std::string line;
+		while (std::getline(in, line)) {
+				if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+				if (line.empty() || line[0] == '#') { continue; }
+			patterns.push_back(line);
+		}
+	return true;
+}
+
+/// @brief parses arguments, returns false when they are invalid
+bool parse_options(const int argc, char** argv, fuzz_options& options) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view arg = argv[i];
+				if (i + 1 >= argc) { return false; }
+
+				if (arg == "--pattern") { options.patterns.emplace_back(argv[++i]); }
+				else if (arg == "--patterns") {
+						if (!read_patterns(argv[++i], options.patterns)) {
+							std::fprintf(stderr, "Can't read %s\n", argv[i]);
+							return false;
+						}
+				}
+				else if (arg == "--iterations") { options.iterations = std::strtoull(argv[++i], nullptr, 10); }
+				else if (arg == "--max-size") { options.max_size = std::strtoull(argv[++i], nullptr, 10); }
+				else if (arg == "--keep") { options.keep = std::strtoull(argv[++i], nullptr, 10); }
+				else if (arg == "--match-limit") {
+					options.match_limit = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+				}
+				else if (arg == "--seed") { options.seed = std::strtoull(argv[++i], nullptr, 10); }
+				else if (arg == "--corpus") { options.corpus = argv[++i]; }
+				else { return false; }
+		}
+	return !options.patterns.empty();
+}
+
+int main(const int argc, char** argv) {
+	fuzz_options options;
+		if (!parse_options(argc, argv, options)) {
+			print_usage();
+			return 2;
+		}
+
+	bool is_valid = true;
+		for (const std::string& pattern : options.patterns) {
+				if (!pcre2cpp::is_pattern_valid(pattern)) {
+					std::fprintf(stderr, "Invalid pattern: %s\n", pattern.c_str());
+					is_valid = false;
+					continue;
+				}
+
+			slow_input_fuzzer fuzzer(pattern, options.match_limit, options.max_size, options.keep, options.seed);
+			fuzzer.run(options.iterations);
+
+			const scored_input& worst = fuzzer.get_worst().front();
+			std::printf("%016llx %12zu steps %6zu bytes%s  %s\n", static_cast<unsigned long long>(hash_text(pattern)),
+			  worst.steps, worst.subject.size(), worst.limit_reached ? " (match limit)" : "", pattern.c_str());
+
+				if (!options.corpus.empty() && !fuzzer.save(options.corpus)) {
+					std::fprintf(stderr, "Can't write corpus to %s\n", options.corpus.c_str());
+					is_valid = false;
+				}
+		}
+	return is_valid ? 0 : 1;
+}
+
+	#pragma endregion
+#endif
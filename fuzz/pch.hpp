@@ -0,0 +1,19 @@
+#pragma once
+#ifndef _PCRE2CPP_FUZZ_PCH_HPP_
+	#define _PCRE2CPP_FUZZ_PCH_HPP_
+
+	#include <algorithm>
+	#include <cstdint>
+	#include <cstdio>
+	#include <cstdlib>
+	#include <filesystem>
+	#include <fstream>
+	#include <memory>
+	#include <pcre2cpp/pcre2cpp.hpp>
+	#include <random>
+	#include <string>
+	#include <string_view>
+	#include <utility>
+	#include <vector>
+
+#endif
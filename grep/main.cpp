@@ -0,0 +1,500 @@
+#include <pch.hpp>
+
+#pragma region OPTIONS
+
+/// @brief command line options
+struct grep_options {
+	std::string pattern;
+	std::vector<std::string> files;
+	bool count				= false;
+	bool files_with_matches = false;
+	bool only_matching		= false;
+	bool line_number		= false;
+	bool ignore_case		= false;
+	bool fixed_strings		= false;
+	bool raw				= false;
+	bool stats				= false;
+	/// @brief pattern depends on subject boundaries or text around match, so every line is searched alone (set from pattern)
+	bool per_line			= false;
+	size_t threads			= std::max<size_t>(std::thread::hardware_concurrency(), 1);
+};
+
+void print_usage() {
+	std::fputs("Usage: pcre2cpp-grep [OPTIONS] PATTERN [FILE...]\n"
+			   "Searches lines matching PATTERN (PCRE2 syntax) in FILEs or standard input (when no FILE or FILE is -).\n\n"
+			   "  -c          print only count of matching lines per file\n"
+			   "  -l          print only names of files with matching lines\n"
+			   "  -o          print only matched parts of lines\n"
+			   "  -n          prefix each line with its line number\n"
+			   "  -i          ignore case\n"
+			   "  -F          PATTERN is literal string\n"
+			   "  -j N        count of threads used to search one file (default: hardware concurrency)\n"
+			   "  --raw       match with PCRE2 C API instead of pcre2cpp (for throughput comparison)\n"
+			   "  --stats     print searched bytes, time and throughput to standard error\n"
+			   "  --help      print this help\n",
+	  stderr);
+}
+
+/// @brief parses arguments, returns false when they are invalid
+bool parse_options(const int argc, char** argv, grep_options& options) {
+	bool has_pattern = false;
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view arg = argv[i];
+
+				if (arg == "--raw") { options.raw = true; }
+				else if (arg == "--stats") { options.stats = true; }
+				else if (arg == "--help") { return false; }
+				else if (arg.size() > 1 && arg[0] == '-' && arg != "-") {
+						for (size_t j = 1; j < arg.size(); ++j) {
+								switch (arg[j]) {
+									case 'c': options.count = true; break;
+									case 'l': options.files_with_matches = true; break;
+									case 'o': options.only_matching = true; break;
+									case 'n': options.line_number = true; break;
+									case 'i': options.ignore_case = true; break;
+									case 'F': options.fixed_strings = true; break;
+									case 'j': {
+										// value is rest of argument (-j4) or next argument (-j 4)
+										const char* value = j + 1 < arg.size() ? argv[i] + j + 1
+																			   : (++i < argc ? argv[i] : nullptr);
+											if (value == nullptr) { return false; }
+										options.threads = std::max<size_t>(std::strtoull(value, nullptr, 10), 1);
+										j				= arg.size();
+										break;
+									}
+									default: return false;
+								}
+						}
+				}
+				else if (!has_pattern) {
+					options.pattern = arg;
+					has_pattern		= true;
+				}
+				else { options.files.emplace_back(arg); }
+		}
+
+		if (options.files.empty()) { options.files.emplace_back("-"); }
+	return has_pattern;
+}
+
+/**
+ * @brief returns true if pattern can match differently in line than in buffer of many lines: \\A, \\Z, \\z and \\G
+ * match at subject boundaries and lookarounds can look at text of other lines (escapes in classes are also counted, so
+ * some patterns are searched per line when it isn't needed)
+ */
+bool uses_line_context(const std::string_view pattern) {
+		for (size_t i = 0; i < pattern.size(); ++i) {
+				if (pattern[i] == '\\' && i + 1 < pattern.size()) {
+					const char escaped = pattern[++i];
+						if (escaped == 'A' || escaped == 'Z' || escaped == 'z' || escaped == 'G') { return true; }
+					continue;
+				}
+
+				if (pattern[i] != '(' || i + 2 >= pattern.size()) { continue; }
+
+			const std::string_view group = pattern.substr(i + 1);
+				// (?=, (?!, (?<= and (?<! or alpha assertions like (*pla: and (*positive_lookbehind:
+				if (group.rfind("?=", 0) == 0 || group.rfind("?!", 0) == 0 || group.rfind("?<=", 0) == 0 ||
+					group.rfind("?<!", 0) == 0 || (group[0] == '*' && std::islower(static_cast<unsigned char>(group[1])))) {
+					return true;
+				}
+		}
+	return false;
+}
+
+#pragma endregion
+
+#pragma region INPUT
+
+/// @brief text of file (memory mapped when possible) or standard input
+class input_text {
+private:
+	std::string _buffer;
+	const char* _data = nullptr;
+	size_t _size	  = 0;
+#if _PCRE2CPP_GREP_HAS_MMAP
+	void* _map = nullptr;
+#endif
+
+	/// @brief reads whole file to buffer
+	bool _read(std::FILE* file) {
+		char chunk[64 * 1024];
+		size_t read;
+			while ((read = std::fread(chunk, 1, sizeof(chunk), file)) != 0) { _buffer.append(chunk, read); }
+		_data = _buffer.data();
+		_size = _buffer.size();
+		return std::ferror(file) == 0;
+	}
+
+public:
+	input_text() = default;
+
+	input_text(const input_text&)			 = delete;
+	input_text& operator=(const input_text&) = delete;
+
+	~input_text() {
+#if _PCRE2CPP_GREP_HAS_MMAP
+			if (_map != nullptr) { munmap(_map, _size); }
+#endif
+	}
+
+	/// @brief opens file (- is standard input), returns false when it can't be read
+	bool open(const std::string& path) {
+			if (path == "-") { return _read(stdin); }
+
+#if _PCRE2CPP_GREP_HAS_MMAP
+		const int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0) { return false; }
+
+		struct stat file_stat {};
+			if (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+				void* map = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+					if (map != MAP_FAILED) {
+						madvise(map, static_cast<size_t>(file_stat.st_size), MADV_SEQUENTIAL);
+						_map  = map;
+						_data = static_cast<const char*>(map);
+						_size = static_cast<size_t>(file_stat.st_size);
+						::close(fd);
+						return true;
+					}
+			}
+		::close(fd);
+#endif
+
+		// pipes, devices and systems without mmap
+		std::FILE* file = std::fopen(path.c_str(), "rb");
+			if (file == nullptr) { return false; }
+		const bool is_read = _read(file);
+		std::fclose(file);
+		return is_read;
+	}
+
+	/// @brief returns text of input
+	std::string_view get_text() const noexcept { return std::string_view(_data, _size); }
+};
+
+#pragma endregion
+
+#pragma region MATCHERS
+
+/// @brief returns compile options of pattern
+pcre2cpp::compile_options get_compile_options(const grep_options& options) {
+	// multiline, so ^ and $ match at beginning and end of every line of searched buffer (pcre2 doesn't allow it with literal)
+	pcre2cpp::compile_options opts = options.fixed_strings ? pcre2cpp::compile_options_bits::Literal
+														   : pcre2cpp::compile_options_bits::Multiline;
+		if (options.ignore_case) { opts |= pcre2cpp::compile_options_bits::Caseless; }
+	return opts;
+}
+
+/// @brief matcher using pcre2cpp (regex isn't shared between threads, because its match data isn't)
+class library_matcher {
+private:
+	pcre2cpp::regex _regex;
+
+public:
+	explicit library_matcher(const grep_options& options) : _regex(options.pattern, get_compile_options(options)) {}
+
+	bool find(const std::string_view text, const size_t offset, size_t& match_start, size_t& match_end) const {
+		return _regex.find(text, match_start, match_end, offset);
+	}
+
+	/// @brief returns offset of next search after match (whole character is skipped after empty match in UTF mode)
+	size_t next_offset(const std::string_view text, const size_t match_start, const size_t match_end) const {
+		return _regex.get_next_offset(text, match_start, match_end);
+	}
+};
+
+/// @brief matcher using PCRE2 C API directly
+class raw_matcher {
+private:
+	pcre2_code_8* _code			  = nullptr;
+	pcre2_match_data_8* _match_data = nullptr;
+	bool _utf						= false;
+
+public:
+	explicit raw_matcher(const grep_options& options) {
+		int error_code;
+		PCRE2_SIZE error_offset;
+		_code = pcre2_compile_8(reinterpret_cast<PCRE2_SPTR8>(options.pattern.data()), options.pattern.size(),
+		  static_cast<uint32_t>(get_compile_options(options)), &error_code, &error_offset, nullptr);
+		_match_data = pcre2_match_data_create_from_pattern_8(_code, nullptr);
+
+		// UTF mode can be set by (*UTF) in pattern
+		uint32_t all_options = 0;
+		pcre2_pattern_info_8(_code, PCRE2_INFO_ALLOPTIONS, &all_options);
+		_utf = (all_options & PCRE2_UTF) != 0;
+	}
+
+	raw_matcher(raw_matcher&& other) noexcept
+		: _code(std::exchange(other._code, nullptr)), _match_data(std::exchange(other._match_data, nullptr)),
+		  _utf(other._utf) {}
+
+	raw_matcher(const raw_matcher&)			   = delete;
+	raw_matcher& operator=(const raw_matcher&) = delete;
+	raw_matcher& operator=(raw_matcher&&)	   = delete;
+
+	~raw_matcher() {
+		pcre2_match_data_free_8(_match_data);
+		pcre2_code_free_8(_code);
+	}
+
+	bool find(const std::string_view text, const size_t offset, size_t& match_start, size_t& match_end) const {
+			if (pcre2_match_8(_code, reinterpret_cast<PCRE2_SPTR8>(text.data()), text.size(), offset, 0, _match_data, nullptr) <
+				0) {
+				return false;
+			}
+
+		const PCRE2_SIZE* offsetVector = pcre2_get_ovector_pointer_8(_match_data);
+		match_start					   = offsetVector[0];
+		match_end					   = offsetVector[1];
+		return true;
+	}
+
+	/// @brief returns offset of next search after match (whole character is skipped after empty match in UTF mode)
+	size_t next_offset(const std::string_view text, const size_t match_start, const size_t match_end) const {
+			if (match_end > match_start) { return match_end; }
+
+		size_t offset = match_start + 1;
+			if (_utf) {
+				while (offset < text.size() && (static_cast<uint8_t>(text[offset]) & 0xC0) == 0x80) { ++offset; }
+			}
+		return offset;
+	}
+};
+
+#pragma endregion
+
+#pragma region SEARCH
+
+/// @brief matched line or part of line (with -o) found in chunk
+struct output_entry {
+	/// @brief line number relative to the beginning of chunk
+	size_t line_idx;
+	std::string_view text;
+};
+
+/// @brief result of search in one chunk of text
+struct chunk_result {
+	size_t matched_lines = 0;
+	/// @brief count of lines in chunk (counted only when line numbers are printed)
+	size_t lines_count	 = 0;
+	std::vector<output_entry> entries;
+};
+
+/// @brief returns true if line matches (searched in line only, so pattern can't look outside it)
+template<class Matcher>
+bool line_matches(const Matcher& matcher, const std::string_view line) {
+	size_t match_start;
+	size_t match_end;
+	return matcher.find(line, 0, match_start, match_end);
+}
+
+/**
+ * @brief searches lines of chunk [begin, end) of text. Whole chunk is searched at once and only line with found match is
+ * extracted, so pcre2 start optimizations and literal search run over long buffers instead of every single line. Patterns
+ * which use line context are searched in every line alone
+ */
+template<class Matcher>
+void search_chunk(const Matcher& matcher, const grep_options& options, const std::string_view text, const size_t begin,
+  const size_t end, const std::atomic<bool>& stop, chunk_result& result) {
+	// match can't end after chunk (begin and end are beginnings of lines)
+	const std::string_view chunk_text = text.substr(0, end);
+	const bool keep_entries			  = !options.count && !options.files_with_matches;
+
+	size_t line_idx					  = 0;
+	size_t counted_offset			  = begin;
+	size_t match_start;
+	size_t match_end;
+
+	// adds matched line, returns false when search can stop
+	const auto add_line				  = [&](const size_t line_begin, const std::string_view line) {
+		++result.matched_lines;
+			if (options.files_with_matches) { return false; }
+			if (!keep_entries) { return true; }
+
+			if (options.line_number) {
+				line_idx += static_cast<size_t>(std::count(text.data() + counted_offset, text.data() + line_begin, '\n'));
+				counted_offset = line_begin;
+			}
+
+			if (!options.only_matching) {
+				result.entries.push_back({ line_idx, line });
+				return true;
+			}
+
+		size_t line_offset = 0;
+			while (line_offset <= line.size() && matcher.find(line, line_offset, match_start, match_end)) {
+					if (match_end > match_start) {
+						result.entries.push_back({ line_idx, line.substr(match_start, match_end - match_start) });
+					}
+				line_offset = matcher.next_offset(line, match_start, match_end);
+			}
+		return true;
+	};
+
+		if (options.per_line) {
+				for (size_t line_begin = begin; line_begin < end && !stop.load(std::memory_order_relaxed);) {
+					const size_t line_end = std::min(chunk_text.find('\n', line_begin), end);
+					const std::string_view line(text.data() + line_begin, line_end - line_begin);
+
+						if (line_matches(matcher, line) && !add_line(line_begin, line)) { return; }
+					line_begin = line_end + 1;
+				}
+		}
+		else {
+			size_t offset = begin;
+				while (offset < end && !stop.load(std::memory_order_relaxed) &&
+					   matcher.find(chunk_text, offset, match_start, match_end)) {
+					const size_t newline	= std::string_view(text.data() + offset, match_start - offset).rfind('\n');
+					const size_t line_begin = newline == std::string_view::npos ? offset : offset + newline + 1;
+					const size_t line_end	= std::min(chunk_text.find('\n', match_start), end);
+					const std::string_view line(text.data() + line_begin, line_end - line_begin);
+
+					offset					= line_end + 1;
+						// match which continues to next lines has to be checked in its line only
+						if (match_end > line_end && !line_matches(matcher, line)) { continue; }
+						if (!add_line(line_begin, line)) { return; }
+				}
+		}
+
+		if (options.line_number && keep_entries) {
+			result.lines_count = static_cast<size_t>(std::count(text.data() + begin, text.data() + end, '\n'));
+		}
+}
+
+/// @brief returns beginnings of chunks (and end of text) splitting text into at most parts_count parts at line boundaries
+std::vector<size_t> split_lines(const std::string_view text, const size_t parts_count) {
+	// too small chunks aren't worth starting thread
+	constexpr size_t min_chunk_size = 1024 * 1024;
+	const size_t chunks_count		= std::clamp<size_t>(text.size() / min_chunk_size, 1, parts_count);
+
+	std::vector<size_t> bounds		= { 0 };
+		for (size_t i = 1; i < chunks_count; ++i) {
+			const size_t newline = text.find('\n', std::max(text.size() / chunks_count * i, bounds.back()));
+				if (newline == std::string_view::npos) { break; }
+				if (newline + 1 > bounds.back() && newline + 1 < text.size()) { bounds.push_back(newline + 1); }
+		}
+	bounds.push_back(text.size());
+	return bounds;
+}
+
+/// @brief searches text using one matcher per chunk (chunks are searched in parallel)
+template<class Matcher>
+std::vector<chunk_result> search_text(const std::vector<Matcher>& matchers, const grep_options& options,
+  const std::string_view text) {
+	const std::vector<size_t> bounds = split_lines(text, matchers.size());
+	std::vector<chunk_result> results(bounds.size() - 1);
+	std::atomic<bool> stop			 = false;
+
+	const auto search				 = [&](const size_t i) {
+		search_chunk(matchers[i], options, text, bounds[i], bounds[i + 1], stop, results[i]);
+			// one matching line is enough to print name of file
+			if (options.files_with_matches && results[i].matched_lines != 0) { stop = true; }
+	};
+
+	std::vector<std::thread> threads;
+		for (size_t i = 1; i < results.size(); ++i) { threads.emplace_back(search, i); }
+	search(0);
+		for (std::thread& thread : threads) { thread.join(); }
+
+	return results;
+}
+
+#pragma endregion
+
+#pragma region OUTPUT
+
+/// @brief prints results of one file, returns count of matched lines
+size_t print_results(const std::vector<chunk_result>& results, const grep_options& options, const std::string& name,
+  const bool print_name, std::string& out) {
+	size_t matched_lines = 0;
+		for (const chunk_result& result : results) { matched_lines += result.matched_lines; }
+
+	const std::string display_name = name == "-" ? "(standard input)" : name;
+		if (options.files_with_matches) {
+				if (matched_lines != 0) { out.append(display_name).push_back('\n'); }
+			return matched_lines;
+		}
+
+		if (options.count) {
+				if (print_name) { out.append(display_name).push_back(':'); }
+			out.append(std::to_string(matched_lines)).push_back('\n');
+			return matched_lines;
+		}
+
+	size_t first_line = 1;
+		for (const chunk_result& result : results) {
+				for (const output_entry& entry : result.entries) {
+						if (print_name) { out.append(display_name).push_back(':'); }
+						if (options.line_number) { out.append(std::to_string(first_line + entry.line_idx)).push_back(':'); }
+					out.append(entry.text).push_back('\n');
+
+						// output is written in parts, so it doesn't hold copy of whole matched text
+						if (out.size() >= 64 * 1024) {
+							std::fwrite(out.data(), 1, out.size(), stdout);
+							out.clear();
+						}
+				}
+			first_line += result.lines_count;
+		}
+	return matched_lines;
+}
+
+#pragma endregion
+
+template<class Matcher>
+int run(const grep_options& options) {
+	std::vector<Matcher> matchers;
+	matchers.reserve(options.threads);
+		for (size_t i = 0; i != options.threads; ++i) { matchers.emplace_back(options); }
+
+	size_t matched_lines   = 0;
+	size_t searched_bytes  = 0;
+	bool has_error		   = false;
+	std::string out;
+
+	const bool print_name  = options.files.size() > 1;
+	const auto start	   = std::chrono::steady_clock::now();
+		for (const std::string& file : options.files) {
+			input_text input;
+				if (!input.open(file)) {
+					std::fprintf(stderr, "pcre2cpp-grep: %s: can't read file\n", file.c_str());
+					has_error = true;
+					continue;
+				}
+
+			const std::string_view text = input.get_text();
+			searched_bytes				+= text.size();
+			matched_lines += print_results(search_text(matchers, options, text), options, file, print_name, out);
+
+			// text of input is unmapped after this iteration
+			std::fwrite(out.data(), 1, out.size(), stdout);
+			out.clear();
+		}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	std::fflush(stdout);
+
+		if (options.stats) {
+			std::fprintf(stderr, "[[GREP]] %s: %zu bytes, %.6f s, %.3f GB/s\n", options.raw ? "PCRE2 C" : "pcre2cpp",
+			  searched_bytes, elapsed.count(), static_cast<double>(searched_bytes) / elapsed.count() / 1e9);
+		}
+
+		if (has_error) { return 2; }
+	return matched_lines != 0 ? 0 : 1;
+}
+
+int main(const int argc, char** argv) {
+	grep_options options;
+		if (!parse_options(argc, argv, options)) {
+			print_usage();
+			return 2;
+		}
+
+		if (!pcre2cpp::is_pattern_valid(options.pattern, get_compile_options(options))) {
+			std::fprintf(stderr, "pcre2cpp-grep: invalid pattern: %s\n", options.pattern.c_str());
+			return 2;
+		}
+	options.per_line = !options.fixed_strings && uses_line_context(options.pattern);
+
+	return options.raw ? run<raw_matcher>(options) : run<library_matcher>(options);
+}
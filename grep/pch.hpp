@@ -0,0 +1,28 @@
+#pragma once
+#ifndef _PCRE2CPP_GREP_PCH_HPP_
+	#define _PCRE2CPP_GREP_PCH_HPP_
+
+	#include <algorithm>
+	#include <atomic>
+	#include <cctype>
+	#include <chrono>
+	#include <cstdio>
+	#include <cstring>
+	#include <pcre2cpp/pcre2cpp.hpp>
+	#include <string>
+	#include <string_view>
+	#include <thread>
+	#include <utility>
+	#include <vector>
+
+	#if defined(__unix__) || defined(__APPLE__)
+		#define _PCRE2CPP_GREP_HAS_MMAP 1
+		#include <fcntl.h>
+		#include <sys/mman.h>
+		#include <sys/stat.h>
+		#include <unistd.h>
+	#else
+		#define _PCRE2CPP_GREP_HAS_MMAP 0
+	#endif
+
+#endif
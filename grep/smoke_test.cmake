@@ -0,0 +1,34 @@
+# Runs pcre2cpp-grep (GREP) on small input in WORK_DIR and compares its output with output of grep -P
+# usage: cmake -DGREP=<path> -DWORK_DIR=<dir> -P smoke_test.cmake
+
+set(INPUT "${WORK_DIR}/pcre2cpp_grep_smoke_test.txt")
+file(WRITE ${INPUT} "a\nb\nab\nkey=1 other=22\n")
+
+# checks output and exit code of grep run with given arguments (input file is added at the end)
+function(check_grep expected_output expected_result)
+    foreach (mode "" "--raw")
+        execute_process(COMMAND ${GREP} ${mode} ${ARGN} ${INPUT}
+                OUTPUT_VARIABLE output
+                RESULT_VARIABLE result
+        )
+        if (NOT output STREQUAL expected_output OR NOT result EQUAL expected_result)
+            message(FATAL_ERROR "pcre2cpp-grep ${mode} ${ARGN}: expected '${expected_output}' (${expected_result}), "
+                    "got '${output}' (${result})")
+        endif()
+    endforeach()
+endfunction()
+
+check_grep("2:b\n3:ab\n" 0 -n "b")
+check_grep("2\n" 0 -c "^a")
+check_grep("22\n" 0 -o "\\d\\d")
+check_grep("key=1 other=22\n" 0 -F "=1")
+
+# patterns which depend on subject boundaries or other lines are matched in every line alone
+check_grep("2:b\n" 0 -n "\\Ab")
+check_grep("a\n" 0 "a\\Z")
+check_grep("b\nab\n" 0 "b\\z")
+check_grep("ab\n" 0 "\\Gab")
+check_grep("" 1 "(?<=a\\n)b")
+check_grep("b\nab\n" 0 "(?<!\\n)b")
+
+file(REMOVE ${INPUT})
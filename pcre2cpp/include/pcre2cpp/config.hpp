@@ -258,6 +258,110 @@
 	#endif
 	#pragma endregion
 
+/**
+ * @def _PCRE2CPP_HAS_PMR
+ * @brief check if polymorphic memory resources (<memory_resource>) are available
+ * @ingroup utils
+ */
+	#if defined(__has_include)
+		#if __has_include(<memory_resource>)
+			#define _PCRE2CPP_HAS_PMR _PCRE2CPP_HAS_CXX17
+		#else
+			#define _PCRE2CPP_HAS_PMR 0
+		#endif
+	#else
+		#define _PCRE2CPP_HAS_PMR 0
+	#endif
+
+/**
+ * @def _PCRE2CPP_HAS_SPAN
+ * @brief check if std::span (<span>) is available and c++20 features are enabled
+ * @ingroup utils
+ */
+	#if defined(__has_include)
+		#if __has_include(<span>)
+			#define _PCRE2CPP_HAS_SPAN _PCRE2CPP_HAS_CXX20
+		#else
+			#define _PCRE2CPP_HAS_SPAN 0
+		#endif
+	#else
+		#define _PCRE2CPP_HAS_SPAN 0
+	#endif
+
+/**
+ * @def _PCRE2CPP_HAS_IO_URING
+ * @brief check if io_uring backend of file scanner is enabled by user using PCRE2CPP_ENABLE_IO_URING and liburing is
+ * available
+ * @ingroup utils
+ */
+	#if defined(PCRE2CPP_ENABLE_IO_URING) && defined(__has_include)
+		#if __has_include(<liburing.h>)
+			#define _PCRE2CPP_HAS_IO_URING _PCRE2CPP_HAS_CXX17
+		#else
+			#define _PCRE2CPP_HAS_IO_URING 0
+		#endif
+	#else
+		#define _PCRE2CPP_HAS_IO_URING 0
+	#endif
+
+/**
+ * @def _PCRE2CPP_HAS_STATS
+ * @brief check if runtime statistics of regexes are enabled by user using PCRE2CPP_ENABLE_STATS
+ * @ingroup utils
+ */
+	#ifdef PCRE2CPP_ENABLE_STATS
+		#define _PCRE2CPP_HAS_STATS _PCRE2CPP_HAS_CXX17
+	#else
+		#define _PCRE2CPP_HAS_STATS 0
+	#endif
+
+/**
+ * @def _PCRE2CPP_HAS_SLOW_MATCH_LOG
+ * @brief check if logging of slow matches of regexes is enabled by user using PCRE2CPP_ENABLE_SLOW_MATCH_LOG
+ * @ingroup utils
+ */
+	#ifdef PCRE2CPP_ENABLE_SLOW_MATCH_LOG
+		#define _PCRE2CPP_HAS_SLOW_MATCH_LOG _PCRE2CPP_HAS_CXX17
+	#else
+		#define _PCRE2CPP_HAS_SLOW_MATCH_LOG 0
+	#endif
+
+	#pragma region COMPILED_LIBRARY
+/**
+ * @def _PCRE2CPP_COMPILED_LIB
+ * @brief check if pcre2cpp is used through compiled library (PCRE2CPP_COMPILED_LIB is defined by pcre2cpp-compiled
+ * target)
+ * @ingroup utils
+ */
+
+/**
+ * @def _PCRE2CPP_EXTERN_TEMPLATES
+ * @brief check if templates for all enabled UTF types should be taken from compiled library instead of being
+ * instantiated in every translation unit (disabled in library source, which defines PCRE2CPP_COMPILED_LIB_SOURCE)
+ * @ingroup utils
+ */
+
+/**
+ * @def _PCRE2CPP_COLD_CONSTEXPR
+ * @brief constexpr for c++20 and higher in header only mode and nothing in compiled library mode, so cold functions
+ * (error messages formatting) are compiled only once in library
+ * @ingroup utils
+ */
+	#ifdef PCRE2CPP_COMPILED_LIB
+		#define _PCRE2CPP_COMPILED_LIB 1
+		#define _PCRE2CPP_COLD_CONSTEXPR
+	#else
+		#define _PCRE2CPP_COMPILED_LIB 0
+		#define _PCRE2CPP_COLD_CONSTEXPR _PCRE2CPP_CONSTEXPR20
+	#endif
+
+	#if _PCRE2CPP_COMPILED_LIB && !defined(PCRE2CPP_COMPILED_LIB_SOURCE)
+		#define _PCRE2CPP_EXTERN_TEMPLATES 1
+	#else
+		#define _PCRE2CPP_EXTERN_TEMPLATES 0
+	#endif
+	#pragma endregion
+
 /**
  * @def _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17
  * @brief adds constexpr to pcre2 function pointers only if pcre2 is static library
@@ -37,7 +37,7 @@ namespace pcre2cpp {
 	 * @return string value of type compatible with UTF type
 	 */
 	template<utf_type utf>
-	static _PCRE2CPP_CONSTEXPR17 typename utils::pcre2_data<utf>::string_type generate_error_message(
+	_PCRE2CPP_COLD_CONSTEXPR typename utils::pcre2_data<utf>::string_type generate_error_message(
 	  const int error_code
 	) noexcept {
 		using _pcre2_data_t = utils::pcre2_data<utf>;
@@ -61,7 +61,7 @@ namespace pcre2cpp {
 	 * @return string value of type compatible with UTF type
 	 */
 	template<utf_type utf>
-	static _PCRE2CPP_CONSTEXPR17 typename utils::pcre2_data<utf>::string_type generate_error_message(const int error_code,
+	_PCRE2CPP_COLD_CONSTEXPR typename utils::pcre2_data<utf>::string_type generate_error_message(const int error_code,
 	  const size_t error_offset) noexcept {
 		using _string_type = typename utils::pcre2_data<utf>::string_type;
 
@@ -96,7 +96,7 @@ namespace pcre2cpp {
 	 * @return std::string value of message
 	 */
 	template<utf_type utf>
-	static _PCRE2CPP_CONSTEXPR20 std::string convert_any_utf_to_utf8(const typename utils::pcre2_data<utf>::string_view_type message) noexcept {
+	_PCRE2CPP_COLD_CONSTEXPR std::string convert_any_utf_to_utf8(const typename utils::pcre2_data<utf>::string_view_type message) noexcept {
 		#if _PCRE2CPP_HAS_UTF8
 		if _PCRE2CPP_CONSTEXPR17 (utf == utf_type::UTF_8) { return std::string(message); }
 		else
@@ -122,6 +122,64 @@ namespace pcre2cpp {
 		}
 	}
 
+	/**
+	 * @brief Function which generates error message about missing named subexpression
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 * @param name name of subexpression
+	 * @return string value of type compatible with UTF type
+	 */
+	template<utf_type utf>
+	_PCRE2CPP_COLD_CONSTEXPR typename utils::pcre2_data<utf>::string_type generate_subexpression_not_found_message(
+	  const typename utils::pcre2_data<utf>::string_view_type name) noexcept {
+		using _string_type = typename utils::pcre2_data<utf>::string_type;
+
+		#if _PCRE2CPP_HAS_UTF8
+			if _PCRE2CPP_CONSTEXPR17 (utf == utf_type::UTF_8) {
+				return fmt::format("Subexpression with provided name '{}' not found", name);
+			}
+			else
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+			  if _PCRE2CPP_CONSTEXPR17 (utf == utf_type::UTF_16) {
+				return fmt::format(u"Subexpression with provided name '{}' not found", name);
+			}
+			else
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+			  if _PCRE2CPP_CONSTEXPR17 (utf == utf_type::UTF_32) {
+				return fmt::format(U"Subexpression with provided name '{}' not found", name);
+			}
+			else
+		#endif
+			{
+				return _string_type();
+			}
+	}
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template std::string generate_error_message<utf_type::UTF_8>(const int) noexcept;
+	extern template std::string generate_error_message<utf_type::UTF_8>(const int, const size_t) noexcept;
+	extern template std::string generate_subexpression_not_found_message<utf_type::UTF_8>(const std::string_view) noexcept;
+	extern template std::string convert_any_utf_to_utf8<utf_type::UTF_8>(const std::string_view) noexcept;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template std::u16string generate_error_message<utf_type::UTF_16>(const int) noexcept;
+	extern template std::u16string generate_error_message<utf_type::UTF_16>(const int, const size_t) noexcept;
+	extern template std::u16string generate_subexpression_not_found_message<utf_type::UTF_16>(
+	  const std::u16string_view) noexcept;
+	extern template std::string convert_any_utf_to_utf8<utf_type::UTF_16>(const std::u16string_view) noexcept;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template std::u32string generate_error_message<utf_type::UTF_32>(const int) noexcept;
+	extern template std::u32string generate_error_message<utf_type::UTF_32>(const int, const size_t) noexcept;
+	extern template std::u32string generate_subexpression_not_found_message<utf_type::UTF_32>(
+	  const std::u32string_view) noexcept;
+	extern template std::string convert_any_utf_to_utf8<utf_type::UTF_32>(const std::u32string_view) noexcept;
+			#endif
+		#endif
+
 		#if _PCRE2CPP_HAS_EXCEPTIONS
 			#pragma region PCRE2CPP_EXCEPTION
 
@@ -191,6 +249,9 @@ namespace pcre2cpp {
 		/// @brief constructor with message
 		explicit basic_regex_exception(const _string_view_type message) noexcept : basic_pcre2cpp_exception<utf>(message) {}
 
+		/// @brief constructor with error code
+		explicit basic_regex_exception(const int error_code) noexcept : basic_pcre2cpp_exception<utf>(error_code) {}
+
 		/// @brief constructor with error code and error offset
 		basic_regex_exception(const int error_code, const size_t error_offset) noexcept
 			: basic_pcre2cpp_exception<utf>(error_code, error_offset) {}
@@ -248,6 +309,24 @@ namespace pcre2cpp {
 	using match_result_exception = basic_match_result_exception<default_utf_type>;
 
 			#pragma endregion MATCH_RESULT_EXCEPTION
+
+			#if _PCRE2CPP_EXTERN_TEMPLATES
+				#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_pcre2cpp_exception<utf_type::UTF_8>;
+	extern template class basic_regex_exception<utf_type::UTF_8>;
+	extern template class basic_match_result_exception<utf_type::UTF_8>;
+				#endif
+				#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_pcre2cpp_exception<utf_type::UTF_16>;
+	extern template class basic_regex_exception<utf_type::UTF_16>;
+	extern template class basic_match_result_exception<utf_type::UTF_16>;
+				#endif
+				#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_pcre2cpp_exception<utf_type::UTF_32>;
+	extern template class basic_regex_exception<utf_type::UTF_32>;
+	extern template class basic_match_result_exception<utf_type::UTF_32>;
+				#endif
+			#endif
 		#endif
 } // namespace pcre2cpp
 	#endif
@@ -28,10 +28,44 @@ _PCRE2CPP_ERROR("This is only available for c++17 and greater!");
 		#if _PCRE2CPP_HAS_EXCEPTIONS
 			#include <stdexcept>
 		#endif
+		#include <algorithm>
+		#if _PCRE2CPP_HAS_STATS || _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			#include <array>
+			#include <atomic>
+		#endif
+		#include <charconv>
+		#if _PCRE2CPP_HAS_STATS || _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			#include <chrono>
+		#endif
+		#include <cstddef>
+		#include <cstdio>
+		#include <cstdlib>
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			#include <cstring>
+		#endif
 		#include <fmt/format.h>
 		#include <fmt/xchar.h>
+		#if _PCRE2CPP_HAS_IO_URING
+			#include <fcntl.h>
+			#include <liburing.h>
+			#include <sys/stat.h>
+			#include <unistd.h>
+		#endif
+		#include <limits>
 		#include <memory>
+		#if _PCRE2CPP_HAS_PMR
+			#include <memory_resource>
+		#endif
 		#include <mstd/mstd.hpp>
+		#if _PCRE2CPP_HAS_STATS
+			#include <mutex>
+		#endif
+		#include <optional>
+		#if _PCRE2CPP_HAS_SPAN
+			#include <span>
+		#endif
+		#include <tuple>
+		#include <type_traits>
 		#include <unordered_map>
 		#include <variant>
 		#include <vector>
@@ -0,0 +1,145 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_BYTE_MATCH_VIEW_HPP_
+	#define _PCRE2CPP_BYTE_MATCH_VIEW_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#elif _PCRE2CPP_HAS_UTF8
+
+		#include <pcre2cpp/match/match_view.hpp>
+		#include <pcre2cpp/types.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Non owning view of bytes (std::span<const uint8_t> which is available with c++17)
+	 * @ingroup pcre2cpp
+	 */
+	class byte_view {
+	private:
+		/// @brief pointer to first byte
+		const uint8_t* _data = nullptr;
+		/// @brief count of bytes
+		size_t _size		 = 0;
+
+	public:
+		/// @brief empty view
+		_PCRE2CPP_CONSTEXPR17 byte_view() noexcept = default;
+
+		/// @brief view of given bytes
+		_PCRE2CPP_CONSTEXPR17 byte_view(const uint8_t* data, const size_t size) noexcept : _data(data), _size(size) {}
+
+		/// @brief returns pointer to first byte
+		_PCRE2CPP_CONSTEXPR17 const uint8_t* data() const noexcept { return _data; }
+
+		/// @brief returns count of bytes
+		_PCRE2CPP_CONSTEXPR17 size_t size() const noexcept { return _size; }
+
+		/// @brief returns true if view has no bytes
+		_PCRE2CPP_CONSTEXPR17 bool empty() const noexcept { return _size == 0; }
+
+		/// @brief returns pointer to first byte
+		_PCRE2CPP_CONSTEXPR17 const uint8_t* begin() const noexcept { return _data; }
+
+		/// @brief returns pointer after last byte
+		_PCRE2CPP_CONSTEXPR17 const uint8_t* end() const noexcept { return _data + _size; }
+
+		/// @brief returns byte with given index
+		_PCRE2CPP_CONSTEXPR17 uint8_t operator[](const size_t idx) const noexcept { return _data[idx]; }
+
+		#if _PCRE2CPP_HAS_SPAN
+		/// @brief returns view as std::span
+		constexpr std::span<const uint8_t> as_span() const noexcept { return std::span<const uint8_t>(_data, _size); }
+		#endif
+	};
+
+	/**
+	 * @brief Zero-copy view of single match of binary_regex. Values are bytes of subject, so it is valid only as long as
+	 * subject and offsets are valid (until next match with the same regex)
+	 * @ingroup pcre2cpp
+	 */
+	class byte_match_view {
+	public:
+		/// @brief error offset (returned when value doesn't exist)
+		static _PCRE2CPP_CONSTEXPR17 size_t bad_offset = u8match_view::bad_offset;
+
+	private:
+		/// @brief view of match with subject as chars
+		u8match_view _view;
+
+		/// @brief returns chars as bytes (not constexpr because of reinterpret_cast)
+		static byte_view _as_bytes(const std::string_view chars) noexcept {
+			return byte_view(reinterpret_cast<const uint8_t*>(chars.data()), chars.size());
+		}
+
+	public:
+		/// @brief default constructor (view without value)
+		_PCRE2CPP_CONSTEXPR17 byte_match_view() noexcept = default;
+
+		/// @brief view of match of bytes matched as chars
+		_PCRE2CPP_CONSTEXPR17 explicit byte_match_view(const u8match_view& view) noexcept : _view(view) {}
+
+		/// @brief returns true when view has value
+		_PCRE2CPP_CONSTEXPR17 bool has_value() const noexcept { return _view.has_value(); }
+
+		/// @brief returns whole matched subject
+		byte_view get_subject() const noexcept { return _as_bytes(_view.get_subject()); }
+
+		/// @brief returns offset of value from the beginning of subject
+		_PCRE2CPP_CONSTEXPR17 size_t get_result_global_offset() const noexcept { return _view.get_result_global_offset(); }
+
+		/// @brief returns size of match value
+		_PCRE2CPP_CONSTEXPR17 size_t get_result_size() const noexcept { return _view.get_result_size(); }
+
+		/// @brief returns match value
+		byte_view get_result_value() const noexcept { return _as_bytes(_view.get_result_value()); }
+
+		/// @brief returns sub results count
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_results_count() const noexcept { return _view.get_sub_results_count(); }
+
+		/// @brief returns true when view has sub value on given index
+		_PCRE2CPP_CONSTEXPR17 bool has_sub_value(const size_t idx) const noexcept { return _view.has_sub_value(idx); }
+
+		/// @brief returns true when view has sub value with given name
+		_PCRE2CPP_CONSTEXPR17 bool has_sub_value(const std::string_view name) const noexcept {
+			return _view.has_sub_value(name);
+		}
+
+		/// @brief returns sub result offset from the beginning of subject
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_result_global_offset(const size_t idx) const noexcept {
+			return _view.get_sub_result_global_offset(idx);
+		}
+
+		/// @brief returns sub result offset from the beginning of subject
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_result_global_offset(const std::string_view name) const noexcept {
+			return _view.get_sub_result_global_offset(name);
+		}
+
+		/// @brief returns sub result value
+		byte_view get_sub_result_value(const size_t idx) const noexcept {
+			return _as_bytes(_view.get_sub_result_value(idx));
+		}
+
+		/// @brief returns sub result value
+		byte_view get_sub_result_value(const std::string_view name) const noexcept {
+			return _as_bytes(_view.get_sub_result_value(name));
+		}
+	};
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -0,0 +1,237 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_COLUMN_BATCH_HPP_
+	#define _PCRE2CPP_COLUMN_BATCH_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Column of values of one named group extracted from batch of rows. Values aren't copied, column holds only
+	 * offsets pairs (begin and end of value in its row) and validity bitmap (bit is set when group matched in row)
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_column {
+	private:
+		using _pcre2_data_t = utils::pcre2_data<utf>;
+		using _string_type	= typename _pcre2_data_t::string_type;
+
+		/// @brief name of group
+		_string_type _name;
+		/// @brief index of group in sub results
+		size_t _sub_result_idx = 0;
+		/// @brief pairs of offsets (begin and end) of value in each row
+		std::vector<size_t> _offsets;
+		/// @brief one bit per row (least significant bit first), set when group has value in row
+		std::vector<uint8_t> _validity;
+
+	public:
+		/// @brief column of group with given name and index in sub results
+		_PCRE2CPP_CONSTEXPR20 basic_column(const _string_type& name, const size_t sub_result_idx) noexcept
+			: _name(name), _sub_result_idx(sub_result_idx) {}
+
+		/// @brief clears values and prepares column for given rows count (capacity is kept)
+		_PCRE2CPP_CONSTEXPR20 void reset(const size_t rows_count) noexcept {
+			_offsets.assign(rows_count * 2, 0);
+			_validity.assign((rows_count + 7) / 8, 0);
+		}
+
+		/// @brief stores value from match offsets (pcre2 ovector) in given row
+		_PCRE2CPP_CONSTEXPR17 void set_row(const size_t row, const size_t* offsets, const size_t pairs_count) noexcept {
+			const size_t pair = _sub_result_idx + 1;
+				if (pair >= pairs_count || offsets[pair * 2] == PCRE2_UNSET || offsets[pair * 2 + 1] == PCRE2_UNSET) {
+					return;
+				}
+
+			_offsets[row * 2]	  = offsets[pair * 2];
+			_offsets[row * 2 + 1] = offsets[pair * 2 + 1];
+			_validity[row / 8]	  |= static_cast<uint8_t>(1u << (row % 8));
+		}
+
+		/// @brief returns name of group
+		_PCRE2CPP_CONSTEXPR17 const _string_type& get_name() const noexcept { return _name; }
+
+		/// @brief returns index of group in sub results
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_result_idx() const noexcept { return _sub_result_idx; }
+
+		/// @brief returns rows count
+		_PCRE2CPP_CONSTEXPR17 size_t size() const noexcept { return _offsets.size() / 2; }
+
+		/// @brief returns true when group has value in given row
+		_PCRE2CPP_CONSTEXPR17 bool is_valid(const size_t row) const noexcept {
+				if (row >= size()) { return false; }
+			return (_validity[row / 8] >> (row % 8) & 1u) != 0;
+		}
+
+		/// @brief returns offset of value from the beginning of its row
+		_PCRE2CPP_CONSTEXPR17 size_t get_offset(const size_t row) const noexcept {
+				if (!is_valid(row)) { return 0; }
+			return _offsets[row * 2];
+		}
+
+		/// @brief returns size of value
+		_PCRE2CPP_CONSTEXPR17 size_t get_size(const size_t row) const noexcept {
+				if (!is_valid(row)) { return 0; }
+			return _offsets[row * 2 + 1] - _offsets[row * 2];
+		}
+
+		/// @brief returns pairs of offsets (begin and end in row) of all rows (zeros for invalid rows)
+		_PCRE2CPP_CONSTEXPR17 const std::vector<size_t>& get_offsets() const noexcept { return _offsets; }
+
+		/// @brief returns validity bitmap (one bit per row, least significant bit first)
+		_PCRE2CPP_CONSTEXPR17 const std::vector<uint8_t>& get_validity() const noexcept { return _validity; }
+	};
+
+	/**
+	 * @brief Batch of rows with one column per named group of regex (filled by basic_regex::extract_columns). Rows are
+	 * referenced, not copied, so values are valid only as long as source of rows is valid. Reusing the same batch for
+	 * next rows doesn't allocate when it has enough capacity
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_column_batch {
+	private:
+		using _pcre2_data_t			  = utils::pcre2_data<utf>;
+		using _string_type			  = typename _pcre2_data_t::string_type;
+		using _string_view_type		  = typename _pcre2_data_t::string_view_type;
+		using _named_sub_values_table = typename _pcre2_data_t::named_sub_values_table;
+		using _column_type			  = basic_column<utf>;
+
+		/// @brief referenced rows
+		std::vector<_string_view_type> _rows;
+		/// @brief columns ordered by group index
+		std::vector<_column_type> _columns;
+		/// @brief one bit per row (least significant bit first), set when regex matched row
+		std::vector<uint8_t> _matched;
+
+		/// @brief returns true when columns are the same as named groups from table
+		_PCRE2CPP_CONSTEXPR20 bool _has_columns(const _named_sub_values_table& named_sub_values) const noexcept {
+				if (named_sub_values.size() != _columns.size()) { return false; }
+
+				for (const _column_type& column : _columns) {
+					const auto it = named_sub_values.find(column.get_name());
+						if (it == named_sub_values.end() || it->second != column.get_sub_result_idx()) { return false; }
+				}
+			return true;
+		}
+
+	public:
+		/// @brief clears batch and prepares it for rows and columns of named groups (used by basic_regex::extract_columns)
+		_PCRE2CPP_CONSTEXPR20 void reset(const _named_sub_values_table& named_sub_values,
+		  const std::vector<_string_view_type>& rows) noexcept {
+				if (!_has_columns(named_sub_values)) {
+					_columns.clear();
+					_columns.reserve(named_sub_values.size());
+						for (const auto& [name, idx] : named_sub_values) { _columns.emplace_back(_string_type(name), idx); }
+					std::sort(_columns.begin(), _columns.end(), [](const _column_type& a, const _column_type& b) {
+						return a.get_sub_result_idx() < b.get_sub_result_idx();
+					});
+				}
+
+			_rows.assign(rows.begin(), rows.end());
+			_matched.assign((rows.size() + 7) / 8, 0);
+				for (_column_type& column : _columns) { column.reset(rows.size()); }
+		}
+
+		/// @brief stores match offsets (pcre2 ovector) of given row in all columns (used by basic_regex::extract_columns)
+		_PCRE2CPP_CONSTEXPR17 void set_row(const size_t row, const size_t* offsets, const size_t pairs_count) noexcept {
+			_matched[row / 8] |= static_cast<uint8_t>(1u << (row % 8));
+				for (_column_type& column : _columns) { column.set_row(row, offsets, pairs_count); }
+		}
+
+		/// @brief returns rows count
+		_PCRE2CPP_CONSTEXPR17 size_t size() const noexcept { return _rows.size(); }
+
+		/// @brief returns referenced rows
+		_PCRE2CPP_CONSTEXPR17 const std::vector<_string_view_type>& get_rows() const noexcept { return _rows; }
+
+		/// @brief returns true when regex matched given row
+		_PCRE2CPP_CONSTEXPR17 bool is_matched(const size_t row) const noexcept {
+				if (row >= size()) { return false; }
+			return (_matched[row / 8] >> (row % 8) & 1u) != 0;
+		}
+
+		/// @brief returns bitmap of matched rows (one bit per row, least significant bit first)
+		_PCRE2CPP_CONSTEXPR17 const std::vector<uint8_t>& get_matched() const noexcept { return _matched; }
+
+		/// @brief returns columns ordered by group index
+		_PCRE2CPP_CONSTEXPR17 const std::vector<_column_type>& get_columns() const noexcept { return _columns; }
+
+		/// @brief returns column of group with given name or nullptr
+		_PCRE2CPP_CONSTEXPR17 const _column_type* get_column(const _string_view_type name) const noexcept {
+				for (const _column_type& column : _columns) {
+						if (column.get_name() == name) { return &column; }
+				}
+			return nullptr;
+		}
+
+		/// @brief returns value of column in given row (empty when group has no value)
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_value(const _column_type& column, const size_t row) const noexcept {
+				if (!column.is_valid(row)) { return _string_view_type(); }
+			return _rows[row].substr(column.get_offset(row), column.get_size(row));
+		}
+
+		/// @brief returns value of column with given name in given row (empty when group has no value)
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_value(const _string_view_type name, const size_t row) const noexcept {
+			const _column_type* column = get_column(name);
+				if (column == nullptr) { return _string_view_type(); }
+			return get_value(*column, row);
+		}
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8column		 = basic_column<utf_type::UTF_8>;
+	using u8column_batch = basic_column_batch<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16column		  = basic_column<utf_type::UTF_16>;
+	using u16column_batch = basic_column_batch<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32column		  = basic_column<utf_type::UTF_32>;
+	using u32column_batch = basic_column_batch<utf_type::UTF_32>;
+		#endif
+
+	using column	   = basic_column<default_utf_type>;
+	using column_batch = basic_column_batch<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_column<utf_type::UTF_8>;
+	extern template class basic_column_batch<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_column<utf_type::UTF_16>;
+	extern template class basic_column_batch<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_column<utf_type::UTF_32>;
+	extern template class basic_column_batch<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
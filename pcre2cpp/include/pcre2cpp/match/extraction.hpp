@@ -0,0 +1,66 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_EXTRACTION_HPP_
+	#define _PCRE2CPP_EXTRACTION_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/types.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Binding of named group to struct field
+	 * @ingroup pcre2cpp
+	 * @tparam CharT char type of group name
+	 * @tparam Class struct type
+	 * @tparam Member field type (arithmetic type, string view or std::optional of them)
+	 */
+	template<class CharT, class Class, class Member>
+	struct extraction_field {
+		/// @brief name of group
+		std::basic_string_view<CharT> name;
+		/// @brief pointer to field
+		Member Class::* member;
+	};
+
+	/**
+	 * @brief creates binding of named group to struct field
+	 * @ingroup pcre2cpp
+	 * @param name name of group
+	 * @param member pointer to field
+	 */
+	template<class CharT, class Class, class Member>
+	_PCRE2CPP_CONSTEXPR17 extraction_field<CharT, Class, Member> bind_field(const CharT* name,
+	  Member Class::* member) noexcept {
+		return { std::basic_string_view<CharT>(name), member };
+	}
+
+	/**
+	 * @brief Mapping of named groups to fields of T used by basic_regex::extract. Specialize it with static member
+	 * `fields` which is tuple of bind_field results, e.g.
+	 * `static constexpr auto fields = std::make_tuple(bind_field("port", &T::port));`
+	 * @ingroup pcre2cpp
+	 * @tparam T struct type
+	 */
+	template<class T>
+	struct extraction_traits;
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -0,0 +1,142 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_MATCH_BATCH_HPP_
+	#define _PCRE2CPP_MATCH_BATCH_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/match/match_view.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief All matches of regex in one subject (filled by basic_regex::match_all). Batch owns (or shares) one copy of
+	 * subject and stores offsets of all matches in one contiguous array, so it can outlive matched text and regex, and
+	 * single matches are only views into it
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_match_batch {
+	private:
+		using _pcre2_data_t				  = utils::pcre2_data<utf>;
+		using _string_type				  = typename _pcre2_data_t::string_type;
+		using _string_view_type			  = typename _pcre2_data_t::string_view_type;
+		using _code_type				  = typename _pcre2_data_t::code_type;
+		using _code_ptr					  = std::shared_ptr<_code_type>;
+		using _named_sub_values_table	  = typename _pcre2_data_t::named_sub_values_table;
+		using _named_sub_values_table_ptr = std::shared_ptr<_named_sub_values_table>;
+		using _subject_ptr				  = std::shared_ptr<const _string_type>;
+		using _match_view_type			  = basic_match_view<utf>;
+
+		/// @brief matched subject
+		_subject_ptr _subject						  = nullptr;
+		/// @brief pairs of offsets (begin and end) of match and sub matches of every match from the beginning of subject
+		std::vector<size_t> _offsets;
+		/// @brief count of offsets pairs of one match (match and sub matches)
+		size_t _pairs_count							  = 0;
+		/// @brief pointer to conversion table of named groups to their index
+		_named_sub_values_table_ptr _named_sub_values = nullptr;
+		/// @brief pointer to compiled pcre2 code (names in named sub values table point into it)
+		_code_ptr _code								  = nullptr;
+
+	public:
+		/// @brief clears matches and sets subject and regex data (used by basic_regex::match_all, capacity is kept)
+		_PCRE2CPP_CONSTEXPR20 void reset(const _subject_ptr& subject, const size_t pairs_count,
+		  const _named_sub_values_table_ptr& named_sub_values, const _code_ptr& code) noexcept {
+			_subject		  = subject;
+			_pairs_count	  = pairs_count;
+			_named_sub_values = named_sub_values;
+			_code			  = code;
+			_offsets.clear();
+		}
+
+		/// @brief appends match from offsets (pcre2 ovector with pairs count pairs, used by basic_regex::match_all)
+		_PCRE2CPP_CONSTEXPR20 void push_back(const size_t* offsets) noexcept {
+			_offsets.insert(_offsets.end(), offsets, offsets + _pairs_count * 2);
+		}
+
+		/// @brief reserves space for offsets of given matches count
+		_PCRE2CPP_CONSTEXPR20 void reserve(const size_t matches_count) noexcept {
+			_offsets.reserve(matches_count * _pairs_count * 2);
+		}
+
+		/// @brief returns matched subject
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_subject() const noexcept {
+				if (_subject == nullptr) { return _string_view_type(); }
+			return *_subject;
+		}
+
+		/// @brief returns shared pointer to matched subject
+		_PCRE2CPP_CONSTEXPR17 const _subject_ptr& get_subject_ptr() const noexcept { return _subject; }
+
+		/// @brief returns count of matches
+		_PCRE2CPP_CONSTEXPR17 size_t size() const noexcept {
+				if (_pairs_count == 0) { return 0; }
+			return _offsets.size() / (_pairs_count * 2);
+		}
+
+		/// @brief returns true if batch has no matches
+		_PCRE2CPP_CONSTEXPR17 bool empty() const noexcept { return _offsets.empty(); }
+
+		/// @brief returns count of offsets pairs of one match (match and sub matches)
+		_PCRE2CPP_CONSTEXPR17 size_t get_pairs_count() const noexcept { return _pairs_count; }
+
+		/// @brief returns offsets of all matches (pairs count pairs per match, PCRE2_UNSET for unset sub matches)
+		_PCRE2CPP_CONSTEXPR17 const std::vector<size_t>& get_offsets() const noexcept { return _offsets; }
+
+		/// @brief returns view of match with given index (view without value when index is out of bounds)
+		_PCRE2CPP_CONSTEXPR17 _match_view_type get_match(const size_t idx) const noexcept {
+				if (idx >= size()) { return _match_view_type(); }
+			return _match_view_type(get_subject(), _offsets.data() + idx * _pairs_count * 2, _pairs_count,
+			  _named_sub_values.get());
+		}
+
+		/// @brief returns view of match with given index
+		_PCRE2CPP_CONSTEXPR17 _match_view_type operator[](const size_t idx) const noexcept { return get_match(idx); }
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8match_batch = basic_match_batch<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16match_batch = basic_match_batch<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32match_batch = basic_match_batch<utf_type::UTF_32>;
+		#endif
+
+	using match_batch = basic_match_batch<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_match_batch<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_match_batch<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_match_batch<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -25,6 +25,7 @@ _PCRE2CPP_ERROR("This is only available for c++17 and greater!");
 		#include <pcre2cpp/exceptions/exceptions.hpp>
 		#include <pcre2cpp/match/match_error_codes.hpp>
 		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/parse_value.hpp>
 		#include <pcre2cpp/utils/pcre2_data.hpp>
 
 namespace pcre2cpp {
@@ -34,11 +35,13 @@ namespace pcre2cpp {
 	 * @brief Match value container
 	 * @ingroup pcre2cpp
 	 * @tparam utf UTF type
+	 * @tparam Allocator allocator of value chars
 	 */
-	template<utf_type utf>
+	template<utf_type utf, class Allocator>
 	struct basic_match_value {
 	private:
-		using _string_type = typename utils::pcre2_data<utf>::string_type;
+		using _char_type   = typename utils::pcre2_data<utf>::string_char_type;
+		using _string_type = std::basic_string<_char_type, std::char_traits<_char_type>, Allocator>;
 
 	public:
 		/// @brief offset relative to search offset
@@ -58,6 +61,27 @@ namespace pcre2cpp {
 		#endif
 
 	using match_value = basic_match_value<default_utf_type>;
+
+		#if _PCRE2CPP_HAS_PMR
+	namespace pmr {
+		/// @brief match value container which allocates from memory resource
+		template<utf_type utf>
+		using basic_match_value = pcre2cpp::basic_match_value<utf,
+		  std::pmr::polymorphic_allocator<typename utils::pcre2_data<utf>::string_char_type> >;
+
+			#if _PCRE2CPP_HAS_UTF8
+		using u8match_value = basic_match_value<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+		using u16match_value = basic_match_value<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+		using u32match_value = basic_match_value<utf_type::UTF_32>;
+			#endif
+
+		using match_value = basic_match_value<default_utf_type>;
+	} // namespace pmr
+		#endif
 		#pragma endregion
 
 		#pragma region SUB_MATCH_VALUE
@@ -79,20 +103,29 @@ namespace pcre2cpp {
 	 * @brief Basic container to result data of match function
 	 * @ingroup pcre2cpp
 	 * @tparam utf UTF type
+	 * @tparam Allocator allocator used for match value and sub results (passed to containers of results, e.g. pmr vector)
 	 */
-	template<utf_type utf>
+	template<utf_type utf, class Allocator>
 	class basic_match_result {
 	public:
 		/// @brief error offset (returned when value doesn't exist or when error has occurred)
 		static _PCRE2CPP_CONSTEXPR17 size_t bad_offset = std::numeric_limits<size_t>::max();
 
+		/// @brief allocator type
+		using allocator_type = Allocator;
+
 	private:
-		using _pcre2_data_t		= utils::pcre2_data<utf>;
-		using _code_type		= typename _pcre2_data_t::code_type;
-		using _code_ptr			= std::shared_ptr<_code_type>;
-		using _string_type		= typename _pcre2_data_t::string_type;
-		using _string_view_type = typename _pcre2_data_t::string_view_type;
-		using _match_value		= basic_match_value<utf>;
+		using _pcre2_data_t		  = utils::pcre2_data<utf>;
+		using _code_type		  = typename _pcre2_data_t::code_type;
+		using _code_ptr			  = std::shared_ptr<_code_type>;
+		using _char_type		  = typename _pcre2_data_t::string_char_type;
+		using _string_type		  = std::basic_string<_char_type, std::char_traits<_char_type>, Allocator>;
+		using _error_string_type  = typename _pcre2_data_t::string_type;
+		using _string_view_type	  = typename _pcre2_data_t::string_view_type;
+		using _match_value		  = basic_match_value<utf, Allocator>;
+		using _allocator_traits	  = std::allocator_traits<Allocator>;
+		using _sub_results_type	  = std::vector<std::optional<sub_match_value>,
+			typename _allocator_traits::template rebind_alloc<std::optional<sub_match_value> > >;
 		#if _PCRE2CPP_HAS_EXCEPTIONS
 		using _match_result_exception = basic_match_result_exception<utf>;
 		#endif
@@ -106,7 +139,7 @@ namespace pcre2cpp {
 			/// @brief keeps whole result
 			_match_value result										 = { bad_offset, _string_type() };
 			/// @brief keeps sub results pointers
-			std::vector<std::optional<sub_match_value> > sub_results = {};
+			_sub_results_type sub_results							 = {};
 			/// @brief keeps named sub values mapping
 			_named_sub_values_table_ptr named_sub_values			 = nullptr;
 			/// @brief keeps regex code data in case regex object was destroyed
@@ -115,6 +148,23 @@ namespace pcre2cpp {
 
 		/// @brief Result data
 		std::variant<match_error_codes, _value_result_data> _data = _value_result_data();
+		/// @brief allocator of result data
+		Allocator _allocator									  = Allocator();
+
+		/// @brief returns copy of result data which uses given allocator
+		static _PCRE2CPP_CONSTEXPR20 std::variant<match_error_codes, _value_result_data> _copy_data(
+		  const std::variant<match_error_codes, _value_result_data>& data, const Allocator& alloc) noexcept {
+				if (std::holds_alternative<match_error_codes>(data)) { return std::get<match_error_codes>(data); }
+
+			const auto& value = std::get<_value_result_data>(data);
+			return _value_result_data {
+				.search_offset	  = value.search_offset,
+				.result			  = { value.result.relative_offset, _string_type(value.result.value, alloc) },
+				.sub_results	  = _sub_results_type(value.sub_results.begin(), value.sub_results.end(), alloc),
+				.named_sub_values = value.named_sub_values,
+				.code			  = value.code,
+			};
+		}
 
 		/// @brief returns out of bounds error in correct utf format
 		static _PCRE2CPP_CONSTEXPR17 _string_view_type _get_out_of_bounds_string() noexcept {
@@ -140,28 +190,8 @@ namespace pcre2cpp {
 		}
 
 		/// @brief returns subexpression not found error in correct utf format
-		static _PCRE2CPP_CONSTEXPR17 _string_type _get_subexpression_not_found(const _string_view_type name) noexcept {
-		#if _PCRE2CPP_HAS_UTF8
-				if _PCRE2CPP_CONSTEXPR17 (utf == utf_type::UTF_8) {
-					return fmt::format("Subexpression with provided name '{}' not found", name);
-				}
-				else
-		#endif
-		#if _PCRE2CPP_HAS_UTF16
-				  if _PCRE2CPP_CONSTEXPR17 (utf == utf_type::UTF_16) {
-					return fmt::format(u"Subexpression with provided name '{}' not found", name);
-				}
-				else
-		#endif
-		#if _PCRE2CPP_HAS_UTF32
-				  if _PCRE2CPP_CONSTEXPR17 (utf == utf_type::UTF_32) {
-					return fmt::format(U"Subexpression with provided name '{}' not found", name);
-				}
-				else
-		#endif
-				{
-					return _string_type();
-				}
+		static _PCRE2CPP_CONSTEXPR20 _error_string_type _get_subexpression_not_found(const _string_view_type name) noexcept {
+			return pcre2cpp::generate_subexpression_not_found_message<utf>(name);
 		}
 
 		/// @brief returns true if sub result group with given name exists in named groups table
@@ -201,47 +231,92 @@ namespace pcre2cpp {
 		}
 
 	public:
+		/// @brief type of sub results container
+		using sub_results_type = _sub_results_type;
+
 		#pragma region CONSTRUCTORS
 		/// @brief default constructor
 		_PCRE2CPP_CONSTEXPR17 basic_match_result() noexcept = default;
 
+		/// @brief constructor of result without value which uses given allocator
+		_PCRE2CPP_CONSTEXPR20 explicit basic_match_result(const Allocator& alloc) noexcept
+			: _data(_value_result_data {
+				  .result	   = { bad_offset, _string_type(alloc) },
+				  .sub_results = _sub_results_type(alloc),
+			  }),
+			  _allocator(alloc) {}
+
 		/// @brief constructor with error code
-		_PCRE2CPP_CONSTEXPR17 explicit basic_match_result(const match_error_codes error_code) noexcept : _data(error_code) {}
+		_PCRE2CPP_CONSTEXPR17 explicit basic_match_result(const match_error_codes error_code,
+		  const Allocator& alloc = Allocator()) noexcept
+			: _data(error_code), _allocator(alloc) {}
 
 		/// @brief constructor with no value but also without error
-		_PCRE2CPP_CONSTEXPR17 basic_match_result(const size_t search_offset, const _named_sub_values_table_ptr& named_sub_values,
-		  const _code_ptr& regex_compiled_code) noexcept
+		_PCRE2CPP_CONSTEXPR20 basic_match_result(const size_t search_offset, const _named_sub_values_table_ptr& named_sub_values,
+		  const _code_ptr& regex_compiled_code, const Allocator& alloc = Allocator()) noexcept
 			: _data(_value_result_data {
 				  .search_offset	= search_offset,
+				  .result			= { bad_offset, _string_type(alloc) },
+				  .sub_results		= _sub_results_type(alloc),
 				  .named_sub_values = named_sub_values,
 				  .code				= regex_compiled_code,
-			  }) {}
+			  }),
+			  _allocator(alloc) {}
 
-		/// @brief constructor with good result
-		_PCRE2CPP_CONSTEXPR17 basic_match_result(const size_t search_offset, const _match_value& result,
-		  const std::vector<std::optional<sub_match_value> >& sub_results, const _named_sub_values_table_ptr& named_sub_values,
-		  const _code_ptr& regex_compiled_code) noexcept
+		/// @brief constructor with good result (value and sub results should already use given allocator, they are moved)
+		_PCRE2CPP_CONSTEXPR20 basic_match_result(const size_t search_offset, _match_value result, _sub_results_type sub_results,
+		  const _named_sub_values_table_ptr& named_sub_values, const _code_ptr& regex_compiled_code,
+		  const Allocator& alloc = Allocator()) noexcept
 			: _data(_value_result_data {
 				  .search_offset	= search_offset,
-				  .result			= result,
-				  .sub_results		= sub_results,
+				  .result			= std::move(result),
+				  .sub_results		= std::move(sub_results),
 				  .named_sub_values = named_sub_values,
 				  .code				= regex_compiled_code,
-			  }) {}
-
-		/// @brief default copy constructor
-		_PCRE2CPP_CONSTEXPR17 basic_match_result(const basic_match_result& other) noexcept			  = default;
+			  }),
+			  _allocator(alloc) {}
+
+		/// @brief copy constructor
+		_PCRE2CPP_CONSTEXPR20 basic_match_result(const basic_match_result& other) noexcept
+			: _data(other._data), _allocator(_allocator_traits::select_on_container_copy_construction(other._allocator)) {}
+		/// @brief copy constructor which uses given allocator
+		_PCRE2CPP_CONSTEXPR20 basic_match_result(const basic_match_result& other, const Allocator& alloc) noexcept
+			: _data(_copy_data(other._data, alloc)), _allocator(alloc) {}
 		/// @brief default move constructor
-		_PCRE2CPP_CONSTEXPR17 basic_match_result(basic_match_result&& other) noexcept				  = default;
+		_PCRE2CPP_CONSTEXPR17 basic_match_result(basic_match_result&& other) noexcept = default;
+		/// @brief move constructor which uses given allocator (data is copied when allocators aren't equal)
+		_PCRE2CPP_CONSTEXPR20 basic_match_result(basic_match_result&& other, const Allocator& alloc) noexcept
+			: _data(other._allocator == alloc ? std::move(other._data) : _copy_data(other._data, alloc)), _allocator(alloc) {}
 		#pragma endregion
 
 		/// @brief default destructor
-		_PCRE2CPP_CONSTEXPR20 ~basic_match_result() noexcept										  = default;
+		_PCRE2CPP_CONSTEXPR20 ~basic_match_result() noexcept = default;
+
+		/// @brief copy assign operator (allocator is propagated only if allocator traits allow it)
+		_PCRE2CPP_CONSTEXPR20 basic_match_result& operator=(const basic_match_result& other) noexcept {
+				if (this == &other) { return *this; }
+
+				if _PCRE2CPP_CONSTEXPR17 (_allocator_traits::propagate_on_container_copy_assignment::value) {
+					_allocator = other._allocator;
+				}
+				if (_allocator == other._allocator) { _data = other._data; }
+				else { _data = _copy_data(other._data, _allocator); }
+			return *this;
+		}
+		/// @brief move assign operator (allocator is propagated only if allocator traits allow it)
+		_PCRE2CPP_CONSTEXPR20 basic_match_result& operator=(basic_match_result&& other) noexcept {
+				if (this == &other) { return *this; }
 
-		/// @brief default copy assign operator
-		_PCRE2CPP_CONSTEXPR17 basic_match_result& operator=(const basic_match_result& other) noexcept = default;
-		/// @brief default move assign operator
-		_PCRE2CPP_CONSTEXPR17 basic_match_result& operator=(basic_match_result&& other) noexcept	  = default;
+				if _PCRE2CPP_CONSTEXPR17 (_allocator_traits::propagate_on_container_move_assignment::value) {
+					_allocator = other._allocator;
+				}
+				if (_allocator == other._allocator) { _data = std::move(other._data); }
+				else { _data = _copy_data(other._data, _allocator); }
+			return *this;
+		}
+
+		/// @brief returns allocator used by result
+		_PCRE2CPP_CONSTEXPR17 Allocator get_allocator() const noexcept { return _allocator; }
 
 		#pragma region ERRORS
 
@@ -255,8 +330,8 @@ namespace pcre2cpp {
 		}
 
 		/// @brief returns error message
-		_PCRE2CPP_CONSTEXPR17 _string_type get_error_message() const noexcept {
-				if (!has_error()) { return _string_type(); }
+		_PCRE2CPP_CONSTEXPR17 _error_string_type get_error_message() const noexcept {
+				if (!has_error()) { return _error_string_type(); }
 			return pcre2cpp::generate_error_message<utf>(static_cast<int>(std::get<match_error_codes>(_data)));
 		}
 
@@ -302,8 +377,9 @@ namespace pcre2cpp {
 
 		/// @brief returns match result container
 		_PCRE2CPP_CONSTEXPR17 _match_value get_result() const noexcept {
-				if (!has_value()) { return { bad_offset, _string_type() }; }
-			return std::get<_value_result_data>(_data).result;
+				if (!has_value()) { return { bad_offset, _string_type(_allocator) }; }
+			const auto& result = std::get<_value_result_data>(_data).result;
+			return { result.relative_offset, _string_type(result.value, _allocator) };
 		}
 
 		/// @brief returns offset of value from the beginning of searched string
@@ -327,8 +403,19 @@ namespace pcre2cpp {
 
 		/// @brief returns match string value
 		_PCRE2CPP_CONSTEXPR17 _string_type get_result_value() const noexcept {
-				if (!has_value()) { return _string_type(); }
-			return std::get<_value_result_data>(_data).result.value;
+				if (!has_value()) { return _string_type(_allocator); }
+			return _string_type(std::get<_value_result_data>(_data).result.value, _allocator);
+		}
+
+		/**
+		 * @brief parses match value without allocation (string view references value stored in this result)
+		 * @tparam T arithmetic type or string view type
+		 * @return parsed value or nullopt when there is no value or it can't be parsed
+		 */
+		template<class T>
+		_PCRE2CPP_CONSTEXPR17 std::optional<T> get_result_as() const noexcept {
+				if (!has_value()) { return std::nullopt; }
+			return utils::parse_value<T>(_string_view_type(std::get<_value_result_data>(_data).result.value));
 		}
 
 		#pragma endregion RESULT
@@ -336,13 +423,16 @@ namespace pcre2cpp {
 		#pragma region ALL_SUB_RESULTS
 
 		/// @brief returns all sub results
-		_PCRE2CPP_CONSTEXPR20 std::vector<std::optional<sub_match_value> > get_sub_results() const noexcept {
+		_PCRE2CPP_CONSTEXPR20 _sub_results_type get_sub_results() const noexcept {
 				if (!has_value()) { return {}; }
 			return std::get<_value_result_data>(_data).sub_results;
 		}
 
 		/// @brief returns sub results count
-		_PCRE2CPP_CONSTEXPR17 size_t get_sub_results_count() const noexcept { return get_sub_results().size(); }
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_results_count() const noexcept {
+				if (!has_value()) { return 0; }
+			return std::get<_value_result_data>(_data).sub_results.size();
+		}
 
 		/// @brief returns sub results offsets from the beginning of search string
 		_PCRE2CPP_CONSTEXPR20 std::vector<size_t> get_sub_results_global_offsets() const noexcept {
@@ -420,9 +510,9 @@ namespace pcre2cpp {
 			values.reserve(sub_results.size());
 				for (const auto& subResult : sub_results) {
 						if (subResult.has_value()) {
-							values.emplace_back(value.data() + subResult->relative_offset, subResult->size);
+							values.emplace_back(value.data() + subResult->relative_offset, subResult->size, _allocator);
 						}
-						else { values.push_back(_string_type()); }
+						else { values.push_back(_string_type(_allocator)); }
 				}
 			return values;
 		}
@@ -468,11 +558,26 @@ namespace pcre2cpp {
 
 		/// @brief returns sub result string value
 		_PCRE2CPP_CONSTEXPR17 _string_type get_sub_result_value(const size_t idx) const _PCRE2CPP_NOEXCEPT {
-				if (!has_sub_value(idx)) { return _string_type(); }
+				if (!has_sub_value(idx)) { return _string_type(_allocator); }
 
 			const auto [relative_offset, size] = _get_sub_value(idx);
 			const auto& value				   = std::get<_value_result_data>(_data).result.value;
-			return _string_type(value.data() + relative_offset, size);
+			return _string_type(value.data() + relative_offset, size, _allocator);
+		}
+
+		/**
+		 * @brief parses sub result value without allocation (string view references value stored in this result)
+		 * @tparam T arithmetic type or string view type
+		 * @param idx index of sub result
+		 * @return parsed value or nullopt when sub result has no value or it can't be parsed
+		 */
+		template<class T>
+		_PCRE2CPP_CONSTEXPR17 std::optional<T> get_sub_result_as(const size_t idx) const noexcept {
+				if (!has_sub_value(idx)) { return std::nullopt; }
+
+			const auto [relative_offset, size] = std::get<_value_result_data>(_data).sub_results[idx].value();
+			const auto& value				   = std::get<_value_result_data>(_data).result.value;
+			return utils::parse_value<T>(_string_view_type(value.data() + relative_offset, size));
 		}
 
 		#pragma endregion
@@ -509,6 +614,18 @@ namespace pcre2cpp {
 			return get_sub_result_value(_get_named_sub_result_idx(name));
 		}
 
+		/**
+		 * @brief parses sub result value without allocation (string view references value stored in this result)
+		 * @tparam T arithmetic type or string view type
+		 * @param name name of sub result
+		 * @return parsed value or nullopt when sub result doesn't exist, has no value or it can't be parsed
+		 */
+		template<class T>
+		_PCRE2CPP_CONSTEXPR17 std::optional<T> get_sub_result_as(const _string_view_type name) const noexcept {
+				if (!has_result() || !_has_named_sub_result(name)) { return std::nullopt; }
+			return get_sub_result_as<T>(std::get<_value_result_data>(_data).named_sub_values->at(name));
+		}
+
 		#pragma endregion
 
 		#pragma endregion RESULTS
@@ -525,6 +642,39 @@ namespace pcre2cpp {
 		#endif
 
 	using match_result = basic_match_result<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_match_result<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_match_result<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_match_result<utf_type::UTF_32>;
+			#endif
+		#endif
+
+		#if _PCRE2CPP_HAS_PMR
+	namespace pmr {
+		/// @brief match result container which allocates from memory resource
+		template<utf_type utf>
+		using basic_match_result = pcre2cpp::basic_match_result<utf,
+		  std::pmr::polymorphic_allocator<typename utils::pcre2_data<utf>::string_char_type> >;
+
+			#if _PCRE2CPP_HAS_UTF8
+		using u8match_result = basic_match_result<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+		using u16match_result = basic_match_result<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+		using u32match_result = basic_match_result<utf_type::UTF_32>;
+			#endif
+
+		using match_result = basic_match_result<default_utf_type>;
+	} // namespace pmr
+		#endif
 } // namespace pcre2cpp
 	#endif
 #endif
\ No newline at end of file
@@ -0,0 +1,185 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_MATCH_VIEW_HPP_
+	#define _PCRE2CPP_MATCH_VIEW_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Zero-copy view of single match. It doesn't own subject nor offsets, so it is valid only as long as both of them
+	 * are valid (for views created by basic_regex: until next match with the same regex)
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_match_view {
+	public:
+		/// @brief error offset (returned when value doesn't exist)
+		static _PCRE2CPP_CONSTEXPR17 size_t bad_offset = std::numeric_limits<size_t>::max();
+
+	private:
+		using _pcre2_data_t			  = utils::pcre2_data<utf>;
+		using _string_view_type		  = typename _pcre2_data_t::string_view_type;
+		using _named_sub_values_table = typename _pcre2_data_t::named_sub_values_table;
+
+		/// @brief whole matched subject
+		_string_view_type _subject						= _string_view_type();
+		/// @brief pairs of offsets (begin and end) of match and sub matches from the beginning of subject
+		const size_t* _offsets							= nullptr;
+		/// @brief count of offsets pairs (match and sub matches)
+		size_t _pairs_count								= 0;
+		/// @brief named sub values mapping
+		const _named_sub_values_table* _named_sub_values = nullptr;
+
+		/// @brief returns index of sub result with given name or bad_offset
+		_PCRE2CPP_CONSTEXPR17 size_t _get_named_sub_result_idx(const _string_view_type name) const noexcept {
+				if (_named_sub_values == nullptr) { return bad_offset; }
+
+			const auto it = _named_sub_values->find(name);
+				if (it == _named_sub_values->end()) { return bad_offset; }
+			return it->second;
+		}
+
+	public:
+		/// @brief default constructor (view without value)
+		_PCRE2CPP_CONSTEXPR17 basic_match_view() noexcept = default;
+
+		/// @brief constructor with subject, offsets pairs and named sub values mapping
+		_PCRE2CPP_CONSTEXPR17 basic_match_view(const _string_view_type subject, const size_t* offsets, const size_t pairs_count,
+		  const _named_sub_values_table* named_sub_values = nullptr) noexcept
+			: _subject(subject), _offsets(offsets), _pairs_count(pairs_count), _named_sub_values(named_sub_values) {}
+
+		/// @brief returns true when view has value
+		_PCRE2CPP_CONSTEXPR17 bool has_value() const noexcept { return _offsets != nullptr && _pairs_count != 0; }
+
+		/// @brief returns whole matched subject
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_subject() const noexcept { return _subject; }
+
+		#pragma region RESULT
+
+		/// @brief returns offset of value from the beginning of subject
+		_PCRE2CPP_CONSTEXPR17 size_t get_result_global_offset() const noexcept {
+				if (!has_value()) { return bad_offset; }
+			return _offsets[0];
+		}
+
+		/// @brief returns size of match value
+		_PCRE2CPP_CONSTEXPR17 size_t get_result_size() const noexcept {
+				if (!has_value()) { return 0; }
+			return _offsets[1] - _offsets[0];
+		}
+
+		/// @brief returns match value
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_result_value() const noexcept {
+				if (!has_value()) { return _string_view_type(); }
+			return _subject.substr(_offsets[0], _offsets[1] - _offsets[0]);
+		}
+
+		#pragma endregion RESULT
+
+		#pragma region SUB_RESULTS_BY_IDX
+
+		/// @brief returns sub results count
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_results_count() const noexcept {
+				if (!has_value()) { return 0; }
+			return _pairs_count - 1;
+		}
+
+		/// @brief returns true when view has sub value on given index
+		_PCRE2CPP_CONSTEXPR17 bool has_sub_value(const size_t idx) const noexcept {
+				if (idx >= get_sub_results_count()) { return false; }
+			return _offsets[(idx + 1) * 2] != PCRE2_UNSET && _offsets[(idx + 1) * 2 + 1] != PCRE2_UNSET;
+		}
+
+		/// @brief returns sub result offset from the beginning of subject
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_result_global_offset(const size_t idx) const noexcept {
+				if (!has_sub_value(idx)) { return bad_offset; }
+			return _offsets[(idx + 1) * 2];
+		}
+
+		/// @brief returns sub result value size
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_result_size(const size_t idx) const noexcept {
+				if (!has_sub_value(idx)) { return 0; }
+			return _offsets[(idx + 1) * 2 + 1] - _offsets[(idx + 1) * 2];
+		}
+
+		/// @brief returns sub result value
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_sub_result_value(const size_t idx) const noexcept {
+				if (!has_sub_value(idx)) { return _string_view_type(); }
+			return _subject.substr(_offsets[(idx + 1) * 2], get_sub_result_size(idx));
+		}
+
+		#pragma endregion
+
+		#pragma region SUB_RESULTS_BY_NAME
+
+		/// @brief returns true when view has sub value with given name
+		_PCRE2CPP_CONSTEXPR17 bool has_sub_value(const _string_view_type name) const noexcept {
+			return has_sub_value(_get_named_sub_result_idx(name));
+		}
+
+		/// @brief returns sub result offset from the beginning of subject
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_result_global_offset(const _string_view_type name) const noexcept {
+			return get_sub_result_global_offset(_get_named_sub_result_idx(name));
+		}
+
+		/// @brief returns sub result value size
+		_PCRE2CPP_CONSTEXPR17 size_t get_sub_result_size(const _string_view_type name) const noexcept {
+			return get_sub_result_size(_get_named_sub_result_idx(name));
+		}
+
+		/// @brief returns sub result value
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_sub_result_value(const _string_view_type name) const noexcept {
+			return get_sub_result_value(_get_named_sub_result_idx(name));
+		}
+
+		#pragma endregion
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8match_view = basic_match_view<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16match_view = basic_match_view<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32match_view = basic_match_view<utf_type::UTF_32>;
+		#endif
+
+	using match_view = basic_match_view<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_match_view<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_match_view<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_match_view<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
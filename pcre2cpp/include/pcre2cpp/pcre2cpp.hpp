@@ -29,10 +29,29 @@ _PCRE2CPP_ERROR("This is only available for c++17 and greater!");
 		#include <pcre2cpp/utils/pcre2_data.hpp>
 
 		#include <pcre2cpp/exceptions/exceptions.hpp>
+		#include <pcre2cpp/match/byte_match_view.hpp>
+		#include <pcre2cpp/match/column_batch.hpp>
+		#include <pcre2cpp/match/extraction.hpp>
+		#include <pcre2cpp/match/match_batch.hpp>
 		#include <pcre2cpp/match/match_options.hpp>
 		#include <pcre2cpp/match/match_result.hpp>
+		#include <pcre2cpp/match/match_view.hpp>
+		#include <pcre2cpp/regex/backtracking_analyzer.hpp>
+		#include <pcre2cpp/regex/binary_regex.hpp>
+		#include <pcre2cpp/regex/compile_context.hpp>
 		#include <pcre2cpp/regex/compile_options.hpp>
+		#include <pcre2cpp/regex/file_scanner.hpp>
+		#include <pcre2cpp/regex/match_index.hpp>
 		#include <pcre2cpp/regex/regex.hpp>
+		#include <pcre2cpp/regex/regex_profiler.hpp>
+		#if _PCRE2CPP_HAS_STATS
+			#include <pcre2cpp/regex/regex_stats.hpp>
+		#endif
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			#include <pcre2cpp/regex/slow_match_log.hpp>
+		#endif
+		#include <pcre2cpp/regex/stream_matcher.hpp>
+		#include <pcre2cpp/regex/tokenizer.hpp>
 		#if _PCRE2CPP_HAS_ASSERTS
 			#include <pcre2cpp/utils/assert.hpp>
 		#endif
@@ -0,0 +1,968 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_BACKTRACKING_ANALYZER_HPP_
+	#define _PCRE2CPP_BACKTRACKING_ANALYZER_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/regex/compile_options.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Growth of backtracking of pattern with length of subject
+	 * @ingroup pcre2cpp
+	 */
+	enum class backtracking_risk : uint8_t {
+		/// @brief no catastrophic backtracking was found
+		None,
+		/// @brief adjacent quantifiers can split the same text in many ways (time grows polynomially)
+		Polynomial,
+		/// @brief repeated part can match the same text in many ways (time grows exponentially)
+		Exponential
+	};
+
+	/**
+	 * @brief What happens with pattern which is prone to catastrophic backtracking when regex is compiled
+	 * @ingroup pcre2cpp
+	 */
+	enum class backtracking_policy : uint8_t {
+		/// @brief pattern isn't analyzed (default)
+		Ignore,
+		/// @brief pattern is analyzed and warnings are kept by regex
+		Warn,
+		/// @brief pattern is rejected like pattern with syntax error
+		Reject,
+		/// @brief pattern is compiled with match limit (*LIMIT_MATCH), so bad subjects end with match_error_codes::MatchLimit
+		Limit
+	};
+
+	/**
+	 * @brief Settings of backtracking analysis run when regex is compiled with compile context
+	 * @ingroup pcre2cpp
+	 */
+	struct backtracking_check {
+		/// @brief what happens with dangerous pattern
+		backtracking_policy policy = backtracking_policy::Ignore;
+		/// @brief minimal risk of dangerous pattern
+		backtracking_risk min_risk = backtracking_risk::Exponential;
+		/// @brief match limit used by backtracking_policy::Limit
+		uint32_t match_limit	   = 100'000;
+	};
+
+	/**
+	 * @brief Warning about part of pattern prone to catastrophic backtracking
+	 * @ingroup pcre2cpp
+	 */
+	struct backtracking_warning {
+		/// @brief growth of backtracking
+		backtracking_risk risk = backtracking_risk::None;
+		/// @brief offset of offending part of pattern (in code units)
+		size_t offset		   = 0;
+		/// @brief size of offending part of pattern (in code units)
+		size_t size			   = 0;
+		/// @brief description of problem
+		std::string_view reason;
+	};
+
+	/**
+	 * @brief Static analyzer which finds parts of pattern prone to catastrophic backtracking. It parses pattern to tree
+	 * and approximates characters matched by its parts, then reports:
+	 * - repeated parts with inner quantifiers which can match characters following them in the same repetition or the
+	 * next one (e.g. (a+)+, (\\w+\\s?)*) as exponential,
+	 * - repeated alternations with alternatives which can match the same text (e.g. (a|a)*, (\\w|\\d)+) as exponential,
+	 * - unbounded quantifiers separated only by optional items which can match the same characters (e.g. \\d+\\d+,
+	 * .*.*=) as polynomial.
+	 *
+	 * Possessive quantifiers and atomic groups are trusted. Analysis is conservative heuristic (back references, recursion
+	 * and unicode properties are assumed to match anything), so it can report safe pattern, but it doesn't run pcre2
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_backtracking_analyzer {
+	private:
+		using _pcre2_data_t		= utils::pcre2_data<utf>;
+		using _string_view_type = typename _pcre2_data_t::string_view_type;
+		using _string_char_type = typename _pcre2_data_t::string_char_type;
+
+		/// @brief value of max count of unbounded quantifier
+		static _PCRE2CPP_CONSTEXPR17 size_t _unbounded		 = std::numeric_limits<size_t>::max();
+		/// @brief count of positions of alternatives compared by ambiguity check
+		static _PCRE2CPP_CONSTEXPR17 size_t _prefix_limit = 8;
+
+		/// @brief approximate set of characters (ascii characters exactly, all other as one flag)
+		struct _char_set {
+			uint64_t bits[2] = {};
+			bool other		 = false;
+
+			void add(const uint32_t c) noexcept {
+					if (c < 128) { bits[c >> 6] |= uint64_t(1) << (c & 63); }
+					else { other = true; }
+			}
+
+			void add_range(const uint32_t first, const uint32_t last) noexcept {
+					for (uint32_t c = first; c <= last && c < 128; ++c) { add(c); }
+					if (last >= 128) { other = true; }
+			}
+
+			void add_all() noexcept {
+				bits[0] = bits[1] = ~uint64_t(0);
+				other			  = true;
+			}
+
+			void invert() noexcept {
+				bits[0] = ~bits[0];
+				bits[1] = ~bits[1];
+				other	= true;
+			}
+
+			_char_set& operator|=(const _char_set& other_set) noexcept {
+				bits[0] |= other_set.bits[0];
+				bits[1] |= other_set.bits[1];
+				other	 = other || other_set.other;
+				return *this;
+			}
+
+			bool intersects(const _char_set& other_set) const noexcept {
+				return (bits[0] & other_set.bits[0]) != 0 || (bits[1] & other_set.bits[1]) != 0 ||
+					   (other && other_set.other);
+			}
+		};
+
+		/// @brief kind of node of pattern tree
+		enum class _node_kind : uint8_t {
+			/// @brief one character from set
+			Chars,
+			/// @brief zero width item (anchor, assertion, option setting, verb)
+			Assert,
+			/// @brief back reference or recursion (can match anything)
+			Opaque,
+			Sequence,
+			Alternation,
+			Group,
+			Repeat
+		};
+
+		/// @brief node of pattern tree
+		struct _node {
+			_node_kind kind = _node_kind::Assert;
+			/// @brief offset of node in pattern
+			size_t offset	= 0;
+			/// @brief size of node in pattern
+			size_t size		= 0;
+			/// @brief characters of _node_kind::Chars
+			_char_set chars;
+			/// @brief items of sequence, alternatives, content of group or repeated node
+			std::vector<_node> children;
+			/// @brief min count of repetitions
+			size_t min		= 1;
+			/// @brief max count of repetitions
+			size_t max		= 1;
+			/// @brief true if quantifier is possessive
+			bool possessive = false;
+			/// @brief true if group is atomic or lookaround (there is no backtracking into it)
+			bool atomic		= false;
+			/// @brief true if group is lookaround
+			bool zero_width = false;
+		};
+
+		/// @brief characters of subject which can start part of pattern, and whether part can end there
+		struct _prefix {
+			std::vector<_char_set> positions;
+			/// @brief true if whole part is fixed sequence of characters from positions
+			bool complete = true;
+		};
+
+		#pragma region PARSER
+
+		/// @brief recursive descent parser of pattern
+		class _parser {
+		private:
+			_string_view_type _pattern;
+			size_t _pos		= 0;
+			bool _caseless	= false;
+			bool _extended	= false;
+			/// @brief depth of groups (parser stops at closing parenthesis only inside group)
+			size_t _depth	= 0;
+
+			bool _at_end() const noexcept { return _pos >= _pattern.size(); }
+
+			uint32_t _peek(const size_t ahead = 0) const noexcept {
+					if (_pos + ahead >= _pattern.size()) { return 0; }
+				return static_cast<uint32_t>(static_cast<std::make_unsigned_t<_string_char_type>>(_pattern[_pos + ahead]));
+			}
+
+			/// @brief returns current code unit and moves to next one
+			uint32_t _next() noexcept {
+				const uint32_t c = _peek();
+				++_pos;
+				return c;
+			}
+
+			static bool _is_digit(const uint32_t c) noexcept { return c >= '0' && c <= '9'; }
+
+			static bool _is_hex(const uint32_t c) noexcept {
+				return _is_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+			}
+
+			static uint32_t _hex_value(const uint32_t c) noexcept {
+				return _is_digit(c) ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : c - 'A' + 10;
+			}
+
+			/// @brief adds character (and its other case when pattern is caseless)
+			void _add_char(_char_set& set, const uint32_t c) const noexcept {
+				set.add(c);
+					if (_caseless && c >= 'a' && c <= 'z') { set.add(c - 'a' + 'A'); }
+					else if (_caseless && c >= 'A' && c <= 'Z') { set.add(c - 'A' + 'a'); }
+			}
+
+			/// @brief skips to character after first c (or to the end)
+			void _skip_past(const uint32_t c) noexcept {
+					while (!_at_end() && _peek() != c) { ++_pos; }
+					if (!_at_end()) { ++_pos; }
+			}
+
+			/// @brief skips white spaces and comments of extended pattern
+			void _skip_extended() noexcept {
+					while (_extended && !_at_end()) {
+						const uint32_t c = _peek();
+							if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v') { ++_pos; }
+							else if (c == '#') { _skip_past('\n'); }
+							else { break; }
+					}
+			}
+
+			static _node _make(const _node_kind kind, const size_t offset, const size_t size) {
+				_node node;
+				node.kind	= kind;
+				node.offset = offset;
+				node.size	= size;
+				return node;
+			}
+
+			/**
+			 * @brief parses escape after backslash to set (returns true) or to single character (returns false)
+			 * @param set set which gets characters of class escape
+			 * @param c single character of escape
+			 * @param in_class true if escape is inside character class
+			 * @param kind kind of node of escape which isn't character (assertion or back reference)
+			 */
+			bool _parse_escape(_char_set& set, uint32_t& c, const bool in_class, _node_kind& kind) noexcept {
+				kind			 = _node_kind::Chars;
+				const uint32_t e = _peek();
+					if (_at_end()) {
+						c = '\\';
+						return false;
+					}
+				++_pos;
+
+					switch (e) {
+						case 'd':
+						case 'D':
+							set.add_range('0', '9');
+								if (e == 'D') { set.invert(); }
+							return true;
+						case 'w':
+						case 'W':
+							set.add_range('0', '9');
+							set.add_range('a', 'z');
+							set.add_range('A', 'Z');
+							set.add('_');
+								if (e == 'W') { set.invert(); }
+							return true;
+						case 's':
+						case 'S':
+							set.add_range('\t', '\r');
+							set.add(' ');
+								if (e == 'S') { set.invert(); }
+							return true;
+						case 'h':
+						case 'H':
+							set.add('\t');
+							set.add(' ');
+							set.other = true;
+								if (e == 'H') { set.invert(); }
+							return true;
+						case 'v':
+						case 'V':
+							set.add_range('\n', '\r');
+							set.other = true;
+								if (e == 'V') { set.invert(); }
+							return true;
+						case 'R':
+							set.add_range('\n', '\r');
+							set.other = true;
+							return true;
+						case 'N':
+						case 'X':
+						case 'C':
+							set.add_all();
+							return true;
+						case 'p':
+						case 'P':
+								if (_peek() == '{') { _skip_past('}'); }
+								else if (!_at_end()) { ++_pos; }
+							set.add_all();
+							return true;
+						case 'n': c = '\n'; return false;
+						case 't': c = '\t'; return false;
+						case 'r': c = '\r'; return false;
+						case 'f': c = '\f'; return false;
+						case 'e': c = 0x1b; return false;
+						case 'a': c = 0x07; return false;
+						case 'c':
+							c = _peek() ^ 0x40;
+								if (!_at_end()) { ++_pos; }
+							return false;
+						case 'x':
+							c = 0;
+								if (_peek() == '{') {
+									++_pos;
+										while (!_at_end() && _is_hex(_peek())) { c = c * 16 + _hex_value(_next()); }
+									_skip_past('}');
+								}
+								else {
+										for (size_t i = 0; i != 2 && _is_hex(_peek()); ++i) { c = c * 16 + _hex_value(_next()); }
+								}
+							return false;
+						case 'o':
+							c = 0;
+								if (_peek() == '{') {
+									++_pos;
+										while (!_at_end() && _is_digit(_peek())) { c = c * 8 + (_next() - '0'); }
+									_skip_past('}');
+								}
+							return false;
+						case '0':
+							c = 0;
+							// \0 is followed by up to 2 octal digits
+								for (const size_t end = _pos + 2; _pos != end && _peek() >= '0' && _peek() <= '7';) {
+									c = c * 8 + (_next() - '0');
+								}
+							return false;
+						case 'b':
+								if (in_class) {
+									c = 0x08;
+									return false;
+								}
+							kind = _node_kind::Assert;
+							return true;
+						case 'B':
+						case 'A':
+						case 'z':
+						case 'Z':
+						case 'G':
+						case 'K':
+						case 'E':
+							kind = _node_kind::Assert;
+							return true;
+						case 'g':
+						case 'k':
+								if (_peek() == '{') { _skip_past('}'); }
+								else if (_peek() == '<') { _skip_past('>'); }
+								else if (_peek() == '\'') {
+									++_pos;
+									_skip_past('\'');
+								}
+								else {
+										if (_peek() == '+' || _peek() == '-') { ++_pos; }
+										while (_is_digit(_peek())) { ++_pos; }
+								}
+							kind = _node_kind::Opaque;
+							set.add_all();
+							return true;
+						default:
+								if (_is_digit(e) && !in_class) {
+										while (_is_digit(_peek())) { ++_pos; }
+									kind = _node_kind::Opaque;
+									set.add_all();
+									return true;
+								}
+							c = e;
+							return false;
+					}
+			}
+
+			/// @brief parses character class after [
+			_node _parse_class(const size_t start) {
+				_node node	  = _make(_node_kind::Chars, start, 0);
+				const bool negate = _peek() == '^';
+					if (negate) { ++_pos; }
+
+				bool first = true;
+					while (!_at_end() && (_peek() != ']' || first)) {
+						first = false;
+							// posix class
+							if (_peek() == '[' && _peek(1) == ':') {
+								const size_t name_start = _pos + 2;
+								_pos					= name_start;
+									while (!_at_end() && !(_peek() == ':' && _peek(1) == ']')) { ++_pos; }
+								const _string_view_type name = _pattern.substr(name_start, _pos - name_start);
+								_pos						 = std::min(_pos + 2, _pattern.size());
+									if (name.size() == 5 && name[0] == 'd') { node.chars.add_range('0', '9'); }
+									else if (name.size() == 5 && name[0] == 's') {
+										node.chars.add_range('\t', '\r');
+										node.chars.add(' ');
+									}
+									else if (name.size() == 5 && (name[0] == 'u' || name[0] == 'l' || name[0] == 'a')) {
+										node.chars.add_range('a', 'z');
+										node.chars.add_range('A', 'Z');
+											if (name[2] == 'n') { node.chars.add_range('0', '9'); }
+									}
+									else { node.chars.add_all(); }
+								continue;
+							}
+
+						uint32_t low = _peek();
+						++_pos;
+							if (low == '\\') {
+								_node_kind kind;
+									if (_parse_escape(node.chars, low, true, kind)) { continue; }
+							}
+
+							// range
+							if (_peek() == '-' && _peek(1) != ']' && _peek(1) != 0) {
+								++_pos;
+								uint32_t high = _peek();
+								++_pos;
+									if (high == '\\') {
+										_node_kind kind;
+											if (_parse_escape(node.chars, high, true, kind)) {
+												_add_char(node.chars, low);
+												_add_char(node.chars, '-');
+												continue;
+											}
+									}
+									for (uint32_t c = low; c <= high && c < 128; ++c) { _add_char(node.chars, c); }
+									if (high >= 128) { node.chars.other = true; }
+								continue;
+							}
+						_add_char(node.chars, low);
+					}
+					if (!_at_end()) { ++_pos; }
+
+					if (negate) { node.chars.invert(); }
+				node.size = _pos - start;
+				return node;
+			}
+
+			/// @brief parses group after (
+			_node _parse_group(const size_t start) {
+				const bool saved_caseless = _caseless;
+				const bool saved_extended = _extended;
+				_node node				  = _make(_node_kind::Group, start, 0);
+
+					// verb, e.g. (*FAIL)
+					if (_peek() == '*') {
+						_skip_past(')');
+						return _make(_node_kind::Assert, start, _pos - start);
+					}
+
+					if (_peek() == '?') {
+						++_pos;
+						const uint32_t c = _peek();
+							if (c == '#' || c == 'C') {
+								_skip_past(')');
+								return _make(_node_kind::Assert, start, _pos - start);
+							}
+							else if (c == ':' || c == '|') { ++_pos; }
+							else if (c == '>') {
+								++_pos;
+								node.atomic = true;
+							}
+							else if (c == '=' || c == '!' || (c == '<' && (_peek(1) == '=' || _peek(1) == '!'))) {
+								_pos			+= c == '<' ? 2 : 1;
+								node.atomic		= true;
+								node.zero_width = true;
+							}
+							else if (c == '<' || (c == 'P' && _peek(1) == '<')) { _skip_past('>'); }
+							else if (c == '\'') {
+								++_pos;
+								_skip_past('\'');
+							}
+							else if (c == '^' || c == 'J' || c == 'U' || (c >= 'a' && c <= 'z')
+									 || (c == '-' && !_is_digit(_peek(1)))) {
+								// option letters, e.g. (?i) or (?x-i:, only directly after (?
+								bool enable = true;
+									while (!_at_end() && _peek() != ')' && _peek() != ':') {
+										const uint32_t option = _peek();
+											if (option == '-') { enable = false; }
+											else if (option == '^') { _caseless = _extended = false; }
+											else if (option == 'i') { _caseless = enable; }
+											else if (option == 'x') { _extended = enable; }
+										++_pos;
+									}
+									if (_peek() == ')') {
+										// option setting lasts to the end of current group
+										++_pos;
+										return _make(_node_kind::Assert, start, _pos - start);
+									}
+									if (!_at_end()) { ++_pos; }
+							}
+							else if (c == 'P' || c == 'R' || c == '&' || c == '+' || c == '-' || _is_digit(c)) {
+								// recursions and back references
+								_skip_past(')');
+								_node opaque = _make(_node_kind::Opaque, start, _pos - start);
+								opaque.chars.add_all();
+								return opaque;
+							}
+							else if (c == '(') {
+								// condition of conditional group
+								++_pos;
+								size_t depth = 1;
+									while (!_at_end() && depth != 0) {
+											if (_peek() == '\\') { ++_pos; }
+											else if (_peek() == '(') { ++depth; }
+											else if (_peek() == ')') { --depth; }
+										++_pos;
+									}
+							}
+
+					}
+
+				++_depth;
+				node.children.push_back(parse());
+				--_depth;
+					if (!_at_end()) { ++_pos; }
+
+				_caseless = saved_caseless;
+				_extended = saved_extended;
+				node.size = _pos - start;
+				return node;
+			}
+
+			/// @brief parses one item without quantifier
+			_node _parse_atom() {
+				const size_t start = _pos;
+				const uint32_t c   = _peek();
+				++_pos;
+
+					switch (c) {
+						case '(': return _parse_group(start);
+						case '[': return _parse_class(start);
+						case '^':
+						case '$': return _make(_node_kind::Assert, start, 1);
+						case '.': {
+							_node node = _make(_node_kind::Chars, start, 1);
+							node.chars.add_all();
+							return node;
+						}
+						case '\\': {
+								// quoted literal text
+								if (_peek() == 'Q') {
+									++_pos;
+									_node sequence = _make(_node_kind::Sequence, start, 0);
+										while (!_at_end() && !(_peek() == '\\' && _peek(1) == 'E')) {
+											_node node = _make(_node_kind::Chars, _pos, 1);
+											_add_char(node.chars, _peek());
+											sequence.children.push_back(std::move(node));
+											++_pos;
+										}
+									_pos		  = std::min(_pos + 2, _pattern.size());
+									sequence.size = _pos - start;
+									return sequence;
+								}
+
+							_node node = _make(_node_kind::Chars, start, 0);
+							uint32_t value;
+							_node_kind kind;
+								if (!_parse_escape(node.chars, value, false, kind)) { _add_char(node.chars, value); }
+							node.kind = kind;
+							node.size = _pos - start;
+							return node;
+						}
+						default: {
+							_node node = _make(_node_kind::Chars, start, 1);
+							_add_char(node.chars, c);
+							return node;
+						}
+					}
+			}
+
+			/// @brief parses quantifier after item, returns false when there is no quantifier
+			bool _parse_quantifier(size_t& min, size_t& max) noexcept {
+				const uint32_t c = _peek();
+					if (c == '*' || c == '+' || c == '?') {
+						++_pos;
+						min = c == '+' ? 1 : 0;
+						max = c == '?' ? 1 : _unbounded;
+						return true;
+					}
+					if (c != '{') { return false; }
+
+				// {n}, {n,}, {n,m} or {,m}, other braces are literals
+				size_t pos		   = _pos + 1;
+				const auto read_number = [&](size_t& value) {
+					const size_t number_start = pos;
+					value					  = 0;
+						while (pos < _pattern.size() && _is_digit(static_cast<uint32_t>(_pattern[pos]))) {
+							value = value * 10 + static_cast<size_t>(_pattern[pos] - '0');
+							++pos;
+						}
+					return pos != number_start;
+				};
+
+				size_t low				= 0;
+				size_t high				= 0;
+				const bool has_low		= read_number(low);
+					if (pos < _pattern.size() && _pattern[pos] == '}') {
+							if (!has_low) { return false; }
+						_pos = pos + 1;
+						min = max = low;
+						return true;
+					}
+					if (pos >= _pattern.size() || _pattern[pos] != ',') { return false; }
+				++pos;
+				const bool has_high = read_number(high);
+					if (pos >= _pattern.size() || _pattern[pos] != '}' || (!has_low && !has_high)) { return false; }
+
+				_pos = pos + 1;
+				min	 = low;
+				max	 = has_high ? high : _unbounded;
+				return true;
+			}
+
+			/// @brief parses sequence of items to | or )
+			_node _parse_sequence() {
+				_node sequence = _make(_node_kind::Sequence, _pos, 0);
+				_skip_extended();
+					while (!_at_end() && _peek() != '|' && !(_peek() == ')' && _depth != 0)) {
+						_node item = _parse_atom();
+						_skip_extended();
+
+						size_t min;
+						size_t max;
+							if (_parse_quantifier(min, max)) {
+								_node repeat = _make(_node_kind::Repeat, item.offset, 0);
+								repeat.min	 = min;
+								repeat.max	 = max;
+									if (_peek() == '+') {
+										repeat.possessive = true;
+										++_pos;
+									}
+									else if (_peek() == '?') { ++_pos; }
+								repeat.children.push_back(std::move(item));
+								repeat.size = _pos - repeat.offset;
+								item		= std::move(repeat);
+								_skip_extended();
+							}
+						sequence.children.push_back(std::move(item));
+					}
+				sequence.size = _pos - sequence.offset;
+				return sequence;
+			}
+
+		public:
+			_parser(const _string_view_type pattern, const compile_options opts) noexcept : _pattern(pattern) {
+				const uint32_t bits = static_cast<uint32_t>(opts);
+				_caseless			= (bits & PCRE2_CASELESS) != 0;
+				_extended			= (bits & (PCRE2_EXTENDED | PCRE2_EXTENDED_MORE)) != 0;
+			}
+
+			/// @brief parses alternatives to ) or to the end of pattern
+			_node parse() {
+				_node alternation = _make(_node_kind::Alternation, _pos, 0);
+				alternation.children.push_back(_parse_sequence());
+					while (!_at_end() && _peek() == '|') {
+						++_pos;
+						alternation.children.push_back(_parse_sequence());
+					}
+				alternation.size = _pos - alternation.offset;
+					if (alternation.children.size() == 1) { return std::move(alternation.children.front()); }
+				return alternation;
+			}
+		};
+
+		#pragma endregion
+
+		#pragma region ANALYSIS
+
+		/// @brief returns true if node can match empty text
+		static bool _is_nullable(const _node& node) noexcept {
+				switch (node.kind) {
+					case _node_kind::Chars: return false;
+					case _node_kind::Assert:
+					case _node_kind::Opaque: return true;
+					case _node_kind::Sequence:
+						return std::all_of(node.children.begin(), node.children.end(), [](const _node& child) {
+							return _is_nullable(child);
+						});
+					case _node_kind::Alternation:
+						return std::any_of(node.children.begin(), node.children.end(), [](const _node& child) {
+							return _is_nullable(child);
+						});
+					case _node_kind::Group: return node.zero_width || _is_nullable(node.children.front());
+					case _node_kind::Repeat: return node.min == 0 || _is_nullable(node.children.front());
+				}
+			return true;
+		}
+
+		/// @brief returns characters which can start text matched by node
+		static _char_set _first(const _node& node) noexcept {
+			_char_set set;
+				switch (node.kind) {
+					case _node_kind::Chars:
+					case _node_kind::Opaque: return node.chars;
+					case _node_kind::Assert: return set;
+					case _node_kind::Sequence:
+							for (const _node& child : node.children) {
+								set |= _first(child);
+									if (!_is_nullable(child)) { break; }
+							}
+						return set;
+					case _node_kind::Alternation:
+							for (const _node& child : node.children) { set |= _first(child); }
+						return set;
+					case _node_kind::Group: return node.zero_width ? set : _first(node.children.front());
+					case _node_kind::Repeat: return node.max == 0 ? set : _first(node.children.front());
+				}
+			return set;
+		}
+
+		/// @brief returns all characters which can be matched by node
+		static _char_set _all_chars(const _node& node) noexcept {
+				if (node.kind == _node_kind::Chars || node.kind == _node_kind::Opaque) { return node.chars; }
+
+			_char_set set;
+				if (node.zero_width) { return set; }
+				for (const _node& child : node.children) { set |= _all_chars(child); }
+			return set;
+		}
+
+		/// @brief returns true if node is quantifier without upper bound which gives back characters when backtracking
+		static bool _is_unbounded(const _node& node) noexcept {
+				if ((node.kind == _node_kind::Group && !node.atomic) ||
+					(node.kind == _node_kind::Sequence && node.children.size() == 1)) {
+					return _is_unbounded(node.children.front());
+				}
+			return node.kind == _node_kind::Repeat && !node.possessive && node.max == _unbounded && node.min != node.max;
+		}
+
+		/**
+		 * @brief returns true if node contains quantifier with variable count which can match characters following it
+		 * @param node checked node
+		 * @param follow characters which can follow node
+		 */
+		static bool _has_ambiguous_repeat(const _node& node, const _char_set& follow) noexcept {
+				switch (node.kind) {
+					case _node_kind::Sequence: {
+						_char_set after = follow;
+							for (size_t i = node.children.size(); i-- != 0;) {
+								const _node& child = node.children[i];
+									if (_has_ambiguous_repeat(child, after)) { return true; }
+
+									if (_is_nullable(child)) { after |= _first(child); }
+									else { after = _first(child); }
+							}
+						return false;
+					}
+					case _node_kind::Alternation:
+						return std::any_of(node.children.begin(), node.children.end(), [&](const _node& child) {
+							return _has_ambiguous_repeat(child, follow);
+						});
+					case _node_kind::Group: return !node.atomic && _has_ambiguous_repeat(node.children.front(), follow);
+					case _node_kind::Repeat: {
+							if (node.possessive) { return false; }
+
+						const _node& body = node.children.front();
+							if (node.max > node.min && _all_chars(body).intersects(follow)) { return true; }
+
+						_char_set body_follow = follow;
+							if (node.max > 1) { body_follow |= _first(body); }
+						return _has_ambiguous_repeat(body, body_follow);
+					}
+					default: return false;
+				}
+		}
+
+		/// @brief appends characters of fixed beginning of node to prefix, returns false when node isn't fixed sequence
+		static bool _append_prefix(const _node& node, _prefix& prefix) {
+				if (prefix.positions.size() >= _prefix_limit) { return false; }
+
+				switch (node.kind) {
+					case _node_kind::Chars: prefix.positions.push_back(node.chars); return true;
+					case _node_kind::Assert: return true;
+					case _node_kind::Sequence:
+							for (const _node& child : node.children) {
+									if (!_append_prefix(child, prefix)) { return false; }
+							}
+						return true;
+					case _node_kind::Group:
+							if (node.zero_width) { return true; }
+							if (!node.atomic) { return _append_prefix(node.children.front(), prefix); }
+						break;
+					case _node_kind::Repeat:
+							if (node.min == node.max && node.min <= _prefix_limit) {
+									for (size_t i = 0; i != node.min; ++i) {
+											if (!_append_prefix(node.children.front(), prefix)) { return false; }
+									}
+								return true;
+							}
+						break;
+					default: break;
+				}
+
+			// variable part ends prefix, it is represented by its first characters
+			const _char_set first = _first(node);
+				if (_is_nullable(node)) { prefix.positions.push_back(_char_set()); }
+			prefix.positions.push_back(first);
+			prefix.complete = false;
+			return false;
+		}
+
+		/**
+		 * @brief returns true if two alternatives of repeated alternation can match the same text
+		 * @param a first alternative
+		 * @param b second alternative
+		 * @param loop_first characters which can start next repetition
+		 */
+		static bool _are_ambiguous(const _node& a, const _node& b, const _char_set& loop_first) {
+			_prefix prefix_a;
+			_prefix prefix_b;
+			std::ignore = _append_prefix(a, prefix_a);
+			std::ignore = _append_prefix(b, prefix_b);
+
+			const size_t common = std::min(prefix_a.positions.size(), prefix_b.positions.size());
+				for (size_t i = 0; i != common; ++i) {
+						// optional part gives empty position, nothing can be decided after it
+						if (!prefix_a.complete && i + 1 == prefix_a.positions.size()) { return true; }
+						if (!prefix_b.complete && i + 1 == prefix_b.positions.size()) { return true; }
+						if (!prefix_a.positions[i].intersects(prefix_b.positions[i])) { return false; }
+				}
+
+				if (prefix_a.positions.size() == prefix_b.positions.size()) { return true; }
+
+			// shorter fixed alternative is ambiguous only if next repetition can match rest of longer one
+			const _prefix& longer = prefix_a.positions.size() > prefix_b.positions.size() ? prefix_a : prefix_b;
+			return longer.positions[common].intersects(loop_first);
+		}
+
+		/// @brief returns true if node contains alternation with alternatives which can match the same text
+		static bool _has_ambiguous_alternation(const _node& node, const _char_set& loop_first) {
+				if (node.kind == _node_kind::Group && node.atomic) { return false; }
+				if (node.kind == _node_kind::Repeat && node.possessive) { return false; }
+
+				if (node.kind == _node_kind::Alternation) {
+						for (size_t i = 0; i != node.children.size(); ++i) {
+								for (size_t j = i + 1; j != node.children.size(); ++j) {
+										if (_are_ambiguous(node.children[i], node.children[j], loop_first)) { return true; }
+								}
+						}
+				}
+
+			return std::any_of(node.children.begin(), node.children.end(), [&](const _node& child) {
+				return _has_ambiguous_alternation(child, loop_first);
+			});
+		}
+
+		/// @brief finds parts of node prone to catastrophic backtracking
+		static void _analyze(const _node& node, std::vector<backtracking_warning>& warnings) {
+				if (node.kind == _node_kind::Repeat && !node.possessive && node.max == _unbounded) {
+					const _node& body		 = node.children.front();
+					const _char_set loop_first = _first(body);
+						if (_has_ambiguous_repeat(body, loop_first)) {
+							warnings.push_back(backtracking_warning { backtracking_risk::Exponential, node.offset, node.size,
+							  "nested quantifier can match the same characters in many ways" });
+							return;
+						}
+						if (_has_ambiguous_alternation(body, loop_first)) {
+							warnings.push_back(backtracking_warning { backtracking_risk::Exponential, node.offset, node.size,
+							  "repeated alternatives can match the same text" });
+							return;
+						}
+				}
+
+				if (node.kind == _node_kind::Sequence) {
+						for (size_t i = 0; i != node.children.size(); ++i) {
+								if (!_is_unbounded(node.children[i])) { continue; }
+
+							const _char_set chars = _all_chars(node.children[i]);
+								for (size_t j = i + 1; j != node.children.size(); ++j) {
+									const _node& next = node.children[j];
+										if (_is_unbounded(next) && chars.intersects(_all_chars(next))) {
+											warnings.push_back(backtracking_warning { backtracking_risk::Polynomial,
+											  node.children[i].offset, next.offset + next.size - node.children[i].offset,
+											  "adjacent quantifiers can match the same characters" });
+											break;
+										}
+										if (!_is_nullable(next)) { break; }
+								}
+						}
+				}
+
+				for (const _node& child : node.children) { _analyze(child, warnings); }
+		}
+
+		#pragma endregion
+
+	public:
+		/**
+		 * @brief returns parts of pattern prone to catastrophic backtracking (in order of their offsets)
+		 * @param pattern analyzed pattern (it should be valid, invalid pattern gives meaningless warnings)
+		 * @param opts compile options of pattern (caseless and extended modes change meaning of pattern)
+		 */
+		static std::vector<backtracking_warning> analyze(const _string_view_type pattern,
+		  const compile_options opts = compile_options_bits::None) {
+			_parser parser(pattern, opts);
+			const _node root = parser.parse();
+
+			std::vector<backtracking_warning> warnings;
+			_analyze(root, warnings);
+			std::stable_sort(warnings.begin(), warnings.end(),
+			  [](const backtracking_warning& a, const backtracking_warning& b) { return a.offset < b.offset; });
+			return warnings;
+		}
+
+		/// @brief returns the highest risk of warnings
+		static backtracking_risk get_risk(const std::vector<backtracking_warning>& warnings) noexcept {
+			backtracking_risk risk = backtracking_risk::None;
+				for (const backtracking_warning& warning : warnings) { risk = std::max(risk, warning.risk); }
+			return risk;
+		}
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8backtracking_analyzer = basic_backtracking_analyzer<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16backtracking_analyzer = basic_backtracking_analyzer<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32backtracking_analyzer = basic_backtracking_analyzer<utf_type::UTF_32>;
+		#endif
+
+	using backtracking_analyzer = basic_backtracking_analyzer<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_backtracking_analyzer<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_backtracking_analyzer<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_backtracking_analyzer<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -0,0 +1,94 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_BINARY_REGEX_HPP_
+	#define _PCRE2CPP_BINARY_REGEX_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#elif _PCRE2CPP_HAS_UTF8
+
+		#include <pcre2cpp/match/byte_match_view.hpp>
+		#include <pcre2cpp/match/match_options.hpp>
+		#include <pcre2cpp/regex/compile_options.hpp>
+		#include <pcre2cpp/regex/regex.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/byte_range.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Regex which matches binary data (any contiguous range of bytes, e.g. std::span<const std::byte> or
+	 * std::vector<uint8_t>) without UTF semantics. Pattern is always compiled with PCRE2_NEVER_UTF (so (*UTF) in pattern
+	 * or Utf option fail to compile) and subjects are matched in place without copying
+	 * @ingroup pcre2cpp
+	 */
+	class binary_regex {
+	private:
+		/// @brief regex of 8-bit pcre2 library
+		u8regex _regex;
+
+	public:
+		/// @brief binary regex with pattern and compile options (PCRE2_NEVER_UTF is always added)
+		_PCRE2CPP_CONSTEXPR20 explicit binary_regex(const std::string_view pattern,
+		  const compile_options opts = compile_options_bits::None) _PCRE2CPP_NOEXCEPT
+			: _regex(pattern, opts | compile_options_bits::NeverUTF) {}
+
+		/// @brief returns true if match was found
+		template<class Range>
+		_PCRE2CPP_CONSTEXPR17 bool match(const Range& bytes, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			return _regex.match(utils::as_char_view(bytes), offset, opts);
+		}
+
+		/// @brief returns true if match was found and its view is stored in view variable (nothing is copied, view is valid
+		/// until next match with the same regex)
+		template<class Range>
+		_PCRE2CPP_CONSTEXPR17 bool match(const Range& bytes, byte_match_view& view, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			u8match_view char_view;
+			const bool found = _regex.match(utils::as_char_view(bytes), char_view, offset, opts);
+			view			 = byte_match_view(char_view);
+			return found;
+		}
+
+		/// @brief returns true if any match was found (no result is created)
+		template<class Range>
+		_PCRE2CPP_CONSTEXPR17 bool any_match(const Range& bytes, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			return _regex.any_match(utils::as_char_view(bytes), offset, opts);
+		}
+
+		/// @brief finds first match from offset and stores only its offsets (no result is created)
+		template<class Range>
+		_PCRE2CPP_CONSTEXPR17 bool find(const Range& bytes, size_t& match_start, size_t& match_end, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			return _regex.find(utils::as_char_view(bytes), match_start, match_end, offset, opts);
+		}
+
+		/// @brief returns count of all matches found in bytes (no results are created)
+		template<class Range>
+		_PCRE2CPP_CONSTEXPR17 size_t count_matches(const Range& bytes, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			return _regex.count_matches(utils::as_char_view(bytes), offset, opts);
+		}
+
+		/// @brief returns regex of 8-bit pcre2 library used for matching
+		_PCRE2CPP_CONSTEXPR17 const u8regex& get_regex() const noexcept { return _regex; }
+	};
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -0,0 +1,223 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_COMPILE_CONTEXT_HPP_
+	#define _PCRE2CPP_COMPILE_CONTEXT_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/regex/backtracking_analyzer.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Newline conventions
+	 * @ingroup pcre2cpp
+	 */
+	enum class newline_type : uint32_t {
+		/// @brief Carriage return only
+		CR		= PCRE2_NEWLINE_CR,
+		/// @brief Linefeed only
+		LF		= PCRE2_NEWLINE_LF,
+		/// @brief CR followed by LF only
+		CRLF	= PCRE2_NEWLINE_CRLF,
+		/// @brief Any Unicode newline sequence
+		Any		= PCRE2_NEWLINE_ANY,
+		/// @brief Any of CR, LF, or CRLF
+		AnyCRLF = PCRE2_NEWLINE_ANYCRLF,
+		/// @brief NUL character
+		Nul		= PCRE2_NEWLINE_NUL
+	};
+
+	/**
+	 * @brief What \\R matches
+	 * @ingroup pcre2cpp
+	 */
+	enum class bsr_type : uint32_t {
+		/// @brief Any Unicode line ending sequence
+		Unicode = PCRE2_BSR_UNICODE,
+		/// @brief CR, LF, or CRLF only
+		AnyCRLF = PCRE2_BSR_ANYCRLF
+	};
+
+	/**
+	 * @brief Memory management functions used by pcre2 for everything created from compile context (compiled code, its
+	 * match data and match frames). Data is passed to every call and has to be valid as long as regexes compiled with
+	 * the context exist
+	 * @ingroup pcre2cpp
+	 */
+	struct memory_functions {
+		/// @brief allocates memory of given size
+		void* (*malloc)(size_t size, void* data) = nullptr;
+		/// @brief frees memory allocated by malloc
+		void (*free)(void* ptr, void* data)		 = nullptr;
+		/// @brief user data passed to functions
+		void* data								 = nullptr;
+	};
+
+	/**
+	 * @brief Reusable PCRE2 compile context. Copies share the same context, and it is only read during compilation, so
+	 * one context can be used to compile patterns from many threads as long as it isn't modified at the same time
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_compile_context {
+	private:
+		using _pcre2_data_t		 = utils::pcre2_data<utf>;
+
+		using _compile_ctx_type	 = typename _pcre2_data_t::compile_ctx_type;
+		using _compile_ctx_ptr	 = std::shared_ptr<_compile_ctx_type>;
+		using _general_ctx_type	 = typename _pcre2_data_t::general_ctx_type;
+		using _general_ctx_ptr	 = std::shared_ptr<_general_ctx_type>;
+		using _tables_ptr		 = std::shared_ptr<const uint8_t>;
+
+		/// @brief pointer to pcre2 compile context
+		_compile_ctx_ptr _context = nullptr;
+		/// @brief pointer to character tables (compiled code keeps pointer to them, so regexes share ownership)
+		_tables_ptr _tables		  = nullptr;
+		/// @brief pointer to pcre2 general context with memory functions (nullptr when system malloc and free are used)
+		_general_ctx_ptr _general = nullptr;
+		/// @brief backtracking analysis run by regexes compiled with this context
+		backtracking_check _backtracking_check;
+
+	public:
+		/// @brief compile context with default settings
+		_PCRE2CPP_CONSTEXPR20 basic_compile_context() noexcept {
+			_compile_ctx_type* context = _pcre2_data_t::compile_ctx_create(nullptr);
+			_context				   = std::shared_ptr<_compile_ctx_type>(context, _pcre2_data_t::compile_ctx_free);
+		}
+
+		/// @brief compile context with default settings which makes pcre2 allocate memory with given functions
+		_PCRE2CPP_CONSTEXPR20 explicit basic_compile_context(const memory_functions& memory) noexcept {
+			_general_ctx_type* general = _pcre2_data_t::general_ctx_create(memory.malloc, memory.free, memory.data);
+			_general				   = std::shared_ptr<_general_ctx_type>(general, _pcre2_data_t::general_ctx_free);
+
+			_compile_ctx_type* context = _pcre2_data_t::compile_ctx_create(_general.get());
+			_context				   = std::shared_ptr<_compile_ctx_type>(context, _pcre2_data_t::compile_ctx_free);
+		}
+
+		/// @brief default copy constructor
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context(const basic_compile_context& other) noexcept			= default;
+		/// @brief default move constructor
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context(basic_compile_context&& other) noexcept					= default;
+
+		/// @brief default destructor
+		_PCRE2CPP_CONSTEXPR20 ~basic_compile_context() noexcept												= default;
+
+		/// @brief default copy assign operator
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context& operator=(const basic_compile_context& other) noexcept = default;
+		/// @brief default move assign operator
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context& operator=(basic_compile_context&& other) noexcept		= default;
+
+		/// @brief sets character that is recognized as meaning "newline"
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context& set_newline(const newline_type newline) noexcept {
+			_pcre2_data_t::set_newline(_context.get(), static_cast<uint32_t>(newline));
+			return *this;
+		}
+
+		/// @brief sets which characters are matched by \\R
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context& set_bsr(const bsr_type bsr) noexcept {
+			_pcre2_data_t::set_bsr(_context.get(), static_cast<uint32_t>(bsr));
+			return *this;
+		}
+
+		/// @brief sets maximal length (in code units) of pattern which can be compiled
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context& set_max_pattern_length(const size_t length) noexcept {
+			_pcre2_data_t::set_max_pattern_length(_context.get(), length);
+			return *this;
+		}
+
+		/// @brief sets maximal depth of nested parentheses in pattern
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context& set_parens_nest_limit(const uint32_t limit) noexcept {
+			_pcre2_data_t::set_parens_nest_limit(_context.get(), limit);
+			return *this;
+		}
+
+		/**
+		 * @brief generates character tables for current LC_CTYPE locale (set by std::setlocale). Tables are generated once
+		 * and shared by every pattern compiled with this context
+		 */
+		_PCRE2CPP_CONSTEXPR20 basic_compile_context& set_locale_tables() noexcept {
+			const uint8_t* tables = _pcre2_data_t::maketables(_general.get());
+				if (tables == nullptr) { return *this; }
+
+			_tables = std::shared_ptr<const uint8_t>(tables, [general = _general](const uint8_t* tables_ptr) {
+				_pcre2_data_t::maketables_free(general.get(), tables_ptr);
+			});
+			_pcre2_data_t::set_character_tables(_context.get(), _tables.get());
+			return *this;
+		}
+
+		/**
+		 * @brief sets backtracking analysis of patterns compiled with this context. Patterns with parts prone to
+		 * catastrophic backtracking (see basic_backtracking_analyzer) of at least min risk are rejected or limited by
+		 * policy, and found warnings are kept by regex
+		 */
+		_PCRE2CPP_CONSTEXPR17 basic_compile_context& set_backtracking_check(const backtracking_check& check) noexcept {
+			_backtracking_check = check;
+			return *this;
+		}
+
+		/// @brief returns backtracking analysis of patterns compiled with this context
+		_PCRE2CPP_CONSTEXPR17 const backtracking_check& get_backtracking_check() const noexcept { return _backtracking_check; }
+
+		/// @brief returns true if context uses locale character tables instead of built-in ones
+		_PCRE2CPP_CONSTEXPR17 bool has_locale_tables() const noexcept { return _tables != nullptr; }
+
+		/// @brief returns pointer to pcre2 compile context
+		_PCRE2CPP_CONSTEXPR17 _compile_ctx_type* get_context() const noexcept { return _context.get(); }
+
+		/// @brief returns shared pointer to character tables (nullptr when built-in tables are used)
+		_PCRE2CPP_CONSTEXPR17 const _tables_ptr& get_tables() const noexcept { return _tables; }
+
+		/// @brief returns true if pcre2 allocates memory with user memory functions
+		_PCRE2CPP_CONSTEXPR17 bool has_memory_functions() const noexcept { return _general != nullptr; }
+
+		/// @brief returns shared pointer to pcre2 general context (nullptr when system malloc and free are used)
+		_PCRE2CPP_CONSTEXPR17 const _general_ctx_ptr& get_general_context() const noexcept { return _general; }
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8compile_context = basic_compile_context<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16compile_context = basic_compile_context<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32compile_context = basic_compile_context<utf_type::UTF_32>;
+		#endif
+
+	using compile_context = basic_compile_context<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_compile_context<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_compile_context<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_compile_context<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
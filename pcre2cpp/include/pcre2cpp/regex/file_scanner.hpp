@@ -0,0 +1,245 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_FILE_SCANNER_HPP_
+	#define _PCRE2CPP_FILE_SCANNER_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#elif _PCRE2CPP_HAS_UTF8
+
+		#include <pcre2cpp/match/match_error_codes.hpp>
+		#include <pcre2cpp/match/match_options.hpp>
+		#include <pcre2cpp/regex/match_index.hpp>
+		#include <pcre2cpp/regex/regex.hpp>
+		#include <pcre2cpp/regex/stream_matcher.hpp>
+		#include <pcre2cpp/types.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Backends of file scanner
+	 * @ingroup pcre2cpp
+	 */
+	enum class scan_backend : uint8_t {
+		/// @brief Blocking reads into one buffer (matching waits for every read)
+		Blocking,
+		/// @brief Asynchronous reads with io_uring into ring of registered buffers (matching overlaps with reads), used only
+		/// when PCRE2CPP_ENABLE_IO_URING is defined and liburing is available
+		IoUring
+	};
+
+	/**
+	 * @brief Scanner which reads file in buffers and matches it with stream matcher, so it reports the same matches as
+	 * match_all over whole file without reading it to memory first. With io_uring backend next buffers are read while
+	 * current one is matched
+	 * @ingroup pcre2cpp
+	 */
+	class file_scanner {
+	private:
+		/// @brief matched regex
+		u8regex _regex;
+		/// @brief match options used for every match
+		match_options _opts;
+		/// @brief size of one buffer
+		size_t _buffer_size;
+		/// @brief count of buffers (count of reads in flight with io_uring backend)
+		size_t _buffers_count;
+		/// @brief preferred backend
+		scan_backend _backend;
+		/// @brief backend used by last scan
+		scan_backend _last_backend = scan_backend::Blocking;
+
+		/// @brief reads file with blocking reads and matches every buffer, returns false on read or match error
+		template<class Callable>
+		bool _scan_blocking(const std::string& path, u8stream_matcher& matcher, Callable& on_match) const noexcept {
+			std::FILE* file = std::fopen(path.c_str(), "rb");
+				if (file == nullptr) { return false; }
+
+			std::vector<char> buffer(_buffer_size);
+			size_t read;
+			bool matched = true;
+				while (matched && (read = std::fread(buffer.data(), 1, buffer.size(), file)) != 0) {
+					matched = matcher.feed(std::string_view(buffer.data(), read), on_match) == match_error_codes::None;
+				}
+
+			const bool success = matched && std::ferror(file) == 0;
+			std::fclose(file);
+			return success;
+		}
+
+		#if _PCRE2CPP_HAS_IO_URING
+		/// @brief reads regular file with io_uring and matches buffers in file order while next ones are read, returns 1
+		/// on success, 0 on read or match error and -1 when io_uring can't be used (or file isn't regular file)
+		template<class Callable>
+		int _scan_io_uring(const std::string& path, u8stream_matcher& matcher, Callable& on_match) const noexcept {
+			const int fd = ::open(path.c_str(), O_RDONLY);
+				if (fd < 0) { return 0; }
+
+			struct stat info;
+				if (::fstat(fd, &info) != 0) {
+					::close(fd);
+					return 0;
+				}
+				// pipes and devices can't be read at offsets
+				if (!S_ISREG(info.st_mode)) {
+					::close(fd);
+					return -1;
+				}
+
+			io_uring ring;
+				if (io_uring_queue_init(static_cast<unsigned>(_buffers_count), &ring, 0) < 0) {
+					::close(fd);
+					return -1;
+				}
+
+			std::vector<char> storage(_buffers_count * _buffer_size);
+			std::vector<iovec> buffers(_buffers_count);
+				for (size_t i = 0; i != _buffers_count; ++i) {
+					buffers[i] = { storage.data() + i * _buffer_size, _buffer_size };
+				}
+			const bool fixed = io_uring_register_buffers(&ring, buffers.data(), static_cast<unsigned>(_buffers_count)) == 0;
+
+			std::vector<int> results(_buffers_count, 0);
+			std::vector<uint8_t> completed(_buffers_count, 0);
+			size_t in_flight = 0;
+
+			// chunk i is read into buffer i % buffers count, chunks are read until end of file (size from fstat isn't
+			// trusted, because procfs files report size 0)
+			const auto submit = [&](const size_t chunk) {
+				const size_t slot = chunk % _buffers_count;
+				io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+					if (fixed) {
+						io_uring_prep_read_fixed(sqe, fd, buffers[slot].iov_base, static_cast<unsigned>(_buffer_size),
+						  chunk * _buffer_size, static_cast<int>(slot));
+					}
+					else {
+						io_uring_prep_read(sqe, fd, buffers[slot].iov_base, static_cast<unsigned>(_buffer_size),
+						  chunk * _buffer_size);
+					}
+				sqe->user_data	= slot;
+				completed[slot] = 0;
+				++in_flight;
+			};
+			const auto complete = [&]() {
+				io_uring_cqe* cqe;
+					if (io_uring_wait_cqe(&ring, &cqe) < 0) { return false; }
+				results[cqe->user_data]	  = cqe->res;
+				completed[cqe->user_data] = 1;
+				--in_flight;
+				io_uring_cqe_seen(&ring, cqe);
+				return true;
+			};
+
+				for (size_t chunk = 0; chunk != _buffers_count; ++chunk) { submit(chunk); }
+			io_uring_submit(&ring);
+
+			bool success	= true;
+			bool end_of_file = false;
+				for (size_t chunk = 0; success && !end_of_file; ++chunk) {
+					const size_t slot = chunk % _buffers_count;
+						while (success && completed[slot] == 0) { success = complete(); }
+						if (!success || results[slot] < 0) {
+							success = false;
+							break;
+						}
+
+					// short read is finished synchronously, read of 0 bytes means end of file
+					char* data	= static_cast<char*>(buffers[slot].iov_base);
+					size_t read = static_cast<size_t>(results[slot]);
+						while (read < _buffer_size) {
+							const ssize_t result = ::pread(fd, data + read, _buffer_size - read,
+							  static_cast<off_t>(chunk * _buffer_size + read));
+								if (result < 0) { success = false; }
+								if (result <= 0) { break; }
+							read += static_cast<size_t>(result);
+						}
+					end_of_file = read < _buffer_size;
+
+						if (matcher.feed(std::string_view(data, read), on_match) != match_error_codes::None) { success = false; }
+						if (success && !end_of_file) {
+							submit(chunk + _buffers_count);
+							io_uring_submit(&ring);
+						}
+				}
+
+				// kernel can't write to buffers after they are freed
+				while (in_flight != 0 && complete()) {}
+
+				if (fixed) { io_uring_unregister_buffers(&ring); }
+			io_uring_queue_exit(&ring);
+			::close(fd);
+			return success ? 1 : 0;
+		}
+		#endif
+
+	public:
+		/**
+		 * @brief scanner of files
+		 * @param regex matched regex
+		 * @param buffer_size size of one read buffer
+		 * @param buffers_count count of buffers (reads in flight with io_uring backend)
+		 * @param backend preferred backend (blocking reads are used when io_uring isn't available or file isn't regular
+		 * file, e.g. pipe or procfs file)
+		 * @param opts match options used for every match
+		 */
+		explicit file_scanner(const u8regex& regex, const size_t buffer_size = 256 * 1024,
+		  const size_t buffers_count = 4, const scan_backend backend = scan_backend::IoUring,
+		  const match_options opts = match_options_bits::None) noexcept
+			: _regex(regex), _opts(opts), _buffer_size(std::max<size_t>(buffer_size, 1)),
+			  _buffers_count(std::max<size_t>(buffers_count, 1)), _backend(backend) {}
+
+		/// @brief returns true if io_uring backend is compiled in
+		static _PCRE2CPP_CONSTEXPR17 bool has_io_uring() noexcept { return _PCRE2CPP_HAS_IO_URING; }
+
+		/// @brief returns backend used by last scan
+		_PCRE2CPP_CONSTEXPR17 scan_backend get_last_backend() const noexcept { return _last_backend; }
+
+		/**
+		 * @brief scans file and reports all matches in file order
+		 * @tparam Callable callable which takes const match_span& (offset from the beginning of file)
+		 * @param path path of file
+		 * @param on_match callable called for every match
+		 * @return false when file can't be opened, read or matched, e.g. because of match limit (matches found before error
+		 * are already reported)
+		 */
+		template<class Callable>
+		bool scan(const std::string& path, Callable&& on_match) noexcept {
+			u8stream_matcher matcher(_regex, _opts);
+
+		#if _PCRE2CPP_HAS_IO_URING
+				if (_backend == scan_backend::IoUring) {
+					_last_backend	 = scan_backend::IoUring;
+					const int result = _scan_io_uring(path, matcher, on_match);
+						if (result == 1) { return matcher.finish(on_match) == match_error_codes::None; }
+						if (result != -1) { return false; }
+				}
+		#endif
+
+			_last_backend = scan_backend::Blocking;
+				if (!_scan_blocking(path, matcher, on_match)) { return false; }
+			return matcher.finish(on_match) == match_error_codes::None;
+		}
+
+		/// @brief scans file and stores all matches in matches array, returns false when file can't be opened, read or
+		/// matched
+		bool scan(const std::string& path, std::vector<match_span>& matches) noexcept {
+			return scan(path, [&](const match_span& span) { matches.push_back(span); });
+		}
+	};
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -0,0 +1,196 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_MATCH_INDEX_HPP_
+	#define _PCRE2CPP_MATCH_INDEX_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/match/match_options.hpp>
+		#include <pcre2cpp/regex/regex.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Position of indexed match
+	 * @ingroup pcre2cpp
+	 */
+	struct match_span {
+		/// @brief offset from the beginning of text
+		size_t offset;
+		/// @brief size of match
+		size_t size;
+	};
+
+	/**
+	 * @brief Index of all matches of regex in text (the same as match_all would find) which can be updated after edit of
+	 * text by re-matching only window around edit. Window starts at the last match which ends more than lookahead margin
+	 * before edit (this match is matched again, because its optional part can reach edited text) and ends when scan
+	 * resynchronizes with old matches behind edit (and pattern's max lookbehind). Later matches are only shifted.
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_match_index {
+	private:
+		using _pcre2_data_t		= utils::pcre2_data<utf>;
+		using _string_view_type = typename _pcre2_data_t::string_view_type;
+		using _regex_type		= basic_regex<utf>;
+
+		/// @brief indexed regex
+		_regex_type _regex;
+		/// @brief match options used for every match
+		match_options _opts;
+		/// @brief count of characters before edit whose matches are also matched again
+		size_t _lookahead_margin;
+		/// @brief max lookbehind of pattern
+		size_t _lookbehind;
+		/// @brief matches ordered by offset
+		std::vector<match_span> _matches;
+
+		/// @brief returns offset from which match_all continues after given match found in text
+		_PCRE2CPP_CONSTEXPR17 size_t _next_scan_offset(const _string_view_type text, const match_span& span) const noexcept {
+			return _regex.get_next_offset(text, span.offset, span.offset + span.size);
+		}
+
+		/// @brief returns true if match ends more than lookahead margin before edit at given offset
+		_PCRE2CPP_CONSTEXPR17 bool _is_before_edit(const match_span& span, const size_t edit_offset) const noexcept {
+			return span.offset + span.size + _lookahead_margin < edit_offset;
+		}
+
+	public:
+		/**
+		 * @brief index of regex matches
+		 * @param regex indexed regex
+		 * @param lookahead_margin count of characters before edit whose matches are also matched again (0 is enough when
+		 * matching doesn't read text behind the next match, patterns with lookaheads or optional parts which can reach
+		 * over the next match need their length)
+		 * @param opts match options used for every match
+		 */
+		_PCRE2CPP_CONSTEXPR20 explicit basic_match_index(const _regex_type& regex, const size_t lookahead_margin = 0,
+		  const match_options opts = match_options_bits::None) noexcept
+			: _regex(regex), _opts(opts), _lookahead_margin(lookahead_margin), _lookbehind(regex.get_max_lookbehind()) {}
+
+		/// @brief indexes all matches in text
+		_PCRE2CPP_CONSTEXPR20 void build(const _string_view_type text) noexcept {
+			_matches.clear();
+
+			size_t match_start;
+			size_t match_end;
+			size_t offset = 0;
+				while (_regex.find(text, match_start, match_end, offset, _opts)) {
+					_matches.push_back({ match_start, match_end - match_start });
+					offset = _next_scan_offset(text, _matches.back());
+				}
+		}
+
+		/**
+		 * @brief updates index after edit of text
+		 * @param text whole text after edit
+		 * @param edit_offset offset of edit
+		 * @param removed_size count of characters removed at edit offset
+		 * @param inserted_size count of characters inserted at edit offset
+		 */
+		_PCRE2CPP_CONSTEXPR20 void update(const _string_view_type text, const size_t edit_offset, const size_t removed_size,
+		  const size_t inserted_size) noexcept {
+				if (edit_offset > text.size() || inserted_size > text.size() - edit_offset) {
+					build(text);
+					return;
+				}
+
+			// matches before first are not affected by edit, the last match before edit is matched again, because it
+			// could be extended into edited text (e.g. a(?:bc)? matches "a" in "abX" and "abc" after X is replaced by c)
+			auto first = std::partition_point(_matches.begin(), _matches.end(),
+			  [&](const match_span& span) { return _is_before_edit(span, edit_offset); });
+				if (first != _matches.begin()) { --first; }
+			size_t offset = first == _matches.begin() ? 0 : _next_scan_offset(text, *std::prev(first));
+
+			// after scan offset is behind edit and lookbehind, and it is the same as in old scan, old matches are reused
+			const size_t resync_offset = edit_offset + inserted_size + _lookbehind;
+			auto old				   = first;
+			bool resynced			   = false;
+
+			// next offset of old match in old text, text behind edit is the same in new text (shifted by edit)
+			const auto old_next_offset = [&](const match_span& span) {
+					if (span.size != 0) { return span.offset + span.size; }
+					if (span.offset < edit_offset + removed_size) { return span.offset + 1; }
+				const match_span shifted { span.offset + inserted_size - removed_size, 0 };
+				return _next_scan_offset(text, shifted) + removed_size - inserted_size;
+			};
+
+			std::vector<match_span> rescanned;
+			size_t match_start;
+			size_t match_end;
+				while (_regex.find(text, match_start, match_end, offset, _opts)) {
+					rescanned.push_back({ match_start, match_end - match_start });
+					offset = _next_scan_offset(text, rescanned.back());
+						if (offset < resync_offset) { continue; }
+
+					// offsets are compared in old text coordinates (offset - inserted_size + removed_size)
+						while (old != _matches.end() && old_next_offset(*old) + inserted_size < offset + removed_size) { ++old; }
+						if (old != _matches.end() && old_next_offset(*old) + inserted_size == offset + removed_size) {
+							resynced = true;
+							break;
+						}
+				}
+
+			const auto reused = resynced ? std::next(old) : _matches.end();
+				for (auto it = reused; it != _matches.end(); ++it) { it->offset = it->offset + inserted_size - removed_size; }
+
+			const auto inserted = _matches.erase(first, reused);
+			_matches.insert(inserted, rescanned.begin(), rescanned.end());
+		}
+
+		/// @brief returns indexed matches ordered by offset
+		_PCRE2CPP_CONSTEXPR17 const std::vector<match_span>& get_matches() const noexcept { return _matches; }
+
+		/// @brief returns count of indexed matches
+		_PCRE2CPP_CONSTEXPR17 size_t size() const noexcept { return _matches.size(); }
+
+		/// @brief returns lookahead margin
+		_PCRE2CPP_CONSTEXPR17 size_t get_lookahead_margin() const noexcept { return _lookahead_margin; }
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8match_index = basic_match_index<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16match_index = basic_match_index<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32match_index = basic_match_index<utf_type::UTF_32>;
+		#endif
+
+	using match_index = basic_match_index<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_match_index<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_match_index<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_match_index<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -23,11 +23,25 @@ _PCRE2CPP_ERROR("This is only available for c++17 and greater!");
 	#else
 
 		#include <pcre2cpp/exceptions/exceptions.hpp>
+		#include <pcre2cpp/match/column_batch.hpp>
+		#include <pcre2cpp/match/extraction.hpp>
+		#include <pcre2cpp/match/match_batch.hpp>
 		#include <pcre2cpp/match/match_error_codes.hpp>
 		#include <pcre2cpp/match/match_options.hpp>
 		#include <pcre2cpp/match/match_result.hpp>
+		#include <pcre2cpp/match/match_view.hpp>
+		#include <pcre2cpp/regex/backtracking_analyzer.hpp>
+		#include <pcre2cpp/regex/compile_context.hpp>
 		#include <pcre2cpp/regex/compile_options.hpp>
+		#if _PCRE2CPP_HAS_STATS
+			#include <pcre2cpp/regex/regex_stats.hpp>
+		#endif
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			#include <pcre2cpp/regex/slow_match_log.hpp>
+		#endif
 		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/literal_searcher.hpp>
+		#include <pcre2cpp/utils/parse_value.hpp>
 		#include <pcre2cpp/utils/pcre2_data.hpp>
 
 namespace pcre2cpp {
@@ -48,12 +62,29 @@ namespace pcre2cpp {
 		using _string_type				  = typename _pcre2_data_t::string_type;
 		using _string_view_type			  = typename _pcre2_data_t::string_view_type;
 		using _string_char_type			  = typename _pcre2_data_t::string_char_type;
-		using _match_value_type			  = basic_match_value<utf>;
-		using _match_result_type		  = basic_match_result<utf>;
+		template<class Allocator>
+		using _match_value_t = basic_match_value<utf, Allocator>;
+		template<class Allocator>
+		using _match_result_t = basic_match_result<utf, Allocator>;
+		template<class Allocator>
+		using _string_t = std::basic_string<_string_char_type, std::char_traits<_string_char_type>, Allocator>;
+		using _match_view_type			  = basic_match_view<utf>;
+		using _match_batch_type			  = basic_match_batch<utf>;
+		using _subject_ptr				  = std::shared_ptr<const _string_type>;
+		using _column_batch_type		  = basic_column_batch<utf>;
 		using _sptr_type				  = typename _pcre2_data_t::sptr_type;
 		using _named_sub_values_table	  = typename _pcre2_data_t::named_sub_values_table;
 		using _named_sub_values_table_ptr = std::shared_ptr<_named_sub_values_table>;
 		using _uchar_type				  = typename _pcre2_data_t::uchar_type;
+		using _literal_searcher_type	  = utils::literal_searcher<utf>;
+		using _literal_searcher_ptr		  = std::shared_ptr<const _literal_searcher_type>;
+		using _compile_ctx_type			  = typename _pcre2_data_t::compile_ctx_type;
+		using _compile_context_type		  = basic_compile_context<utf>;
+		using _tables_ptr				  = std::shared_ptr<const uint8_t>;
+		using _general_ctx_type			  = typename _pcre2_data_t::general_ctx_type;
+		using _general_ctx_ptr			  = std::shared_ptr<_general_ctx_type>;
+		using _backtracking_analyzer_type = basic_backtracking_analyzer<utf>;
+		using _backtracking_warnings_ptr  = std::shared_ptr<const std::vector<backtracking_warning>>;
 		#if _PCRE2CPP_HAS_EXCEPTIONS
 		using _regex_exception = basic_regex_exception<utf>;
 		#endif
@@ -62,19 +93,262 @@ namespace pcre2cpp {
 		_code_ptr _code								  = nullptr;
 		/// @brief pointer to match data of pcre2 code
 		_match_data_ptr _match_data					  = nullptr;
+		/// @brief pointer to match data with only one offset pair (used when sub results are not needed)
+		_match_data_ptr _min_match_data				  = nullptr;
 		/// @brief pointer to conversion table of named groups to their index
 		_named_sub_values_table_ptr _named_sub_values = nullptr;
+		/// @brief lower bound of length of any matching string (PCRE2_INFO_MINLENGTH)
+		uint32_t _min_length						  = 0;
+		/// @brief true if pattern was compiled in UTF mode (empty matches are skipped by whole characters)
+		bool _utf									  = false;
+		/// @brief pointer to substring searcher used instead of pcre2 when pattern is pure literal
+		_literal_searcher_ptr _literal				  = nullptr;
+		/// @brief pointer to character tables used by compiled code (nullptr when built-in tables are used)
+		_tables_ptr _tables							  = nullptr;
+		/// @brief pointer to general context with memory functions used by pcre2 (nullptr when system ones are used)
+		_general_ctx_ptr _general					  = nullptr;
+		/// @brief pointer to warnings of backtracking analysis (nullptr when pattern wasn't analyzed or is safe)
+		_backtracking_warnings_ptr _backtracking_warnings = nullptr;
+		#if _PCRE2CPP_HAS_STATS
+		/// @brief pointer to runtime statistics (shared by copies of regex like match data)
+		std::shared_ptr<regex_stats> _stats			  = nullptr;
+		#endif
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+		/// @brief pattern of regex (UTF-8) recorded in slow match log
+		std::shared_ptr<const std::string> _slow_match_pattern = nullptr;
+		/// @brief threshold of slow match (negative when threshold of slow match log is used)
+		std::chrono::nanoseconds _slow_match_threshold { -1 };
+		#endif
 
-	public:
-		/// @brief basic regex container with pattern and compile options
-		_PCRE2CPP_CONSTEXPR20 explicit basic_regex(const _string_view_type pattern,
-		  const compile_options opts = compile_options_bits::None) _PCRE2CPP_NOEXCEPT {
+		#if _PCRE2CPP_HAS_STATS
+		/// @brief records match call which searched text from offset to end in statistics
+		void _record_stats(const std::chrono::steady_clock::duration duration, const int match_code, const size_t offset,
+		  const size_t end, _match_data_type* match_data) const noexcept {
+			size_t heap_frames_size = 0;
+			#if _PCRE2CPP_HAS_HEAPFRAMES_SIZE
+				if (match_data != nullptr) { heap_frames_size = _pcre2_data_t::get_heapframes_size(match_data); }
+			#else
+			(void)match_data;
+			#endif
+			_stats->record(match_code, end > offset ? end - offset : 0,
+			  static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()),
+			  heap_frames_size);
+		}
+		#endif
+
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+		/// @brief records match in slow match log when it took longer than threshold or it was stopped by limit
+		void _record_slow_match(const std::chrono::steady_clock::duration duration, const int match_code,
+		  const _string_view_type text, const size_t offset, const match_options opts) const noexcept {
+			slow_match_log& log = slow_match_log::get_instance();
+				if (!log.is_enabled()) { return; }
+
+			const bool is_limit = match_code == static_cast<int>(match_error_codes::MatchLimit) ||
+								  match_code == static_cast<int>(match_error_codes::DepthLimit) ||
+								  match_code == static_cast<int>(match_error_codes::HeapLimit);
+			const std::chrono::nanoseconds threshold =
+			  _slow_match_threshold.count() >= 0 ? _slow_match_threshold : log.get_threshold();
+				if (!is_limit && (threshold.count() == 0 || duration < threshold)) { return; }
+
+			const _string_view_type prefix =
+			  offset < text.size() ? text.substr(offset, slow_match_log::max_subject_size) : _string_view_type();
+			log.record(*_slow_match_pattern, static_cast<uint32_t>(opts), match_code, text.size(),
+			  convert_any_utf_to_utf8<utf>(prefix), std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+		}
+		#endif
+
+		/// @brief runs pcre2 match with given match data (call is recorded when statistics or slow match log are enabled)
+		_PCRE2CPP_CONSTEXPR17 int _pcre2_match(const _string_view_type text, const size_t offset, const match_options opts,
+		  _match_data_type* match_data) const noexcept {
+		#if _PCRE2CPP_HAS_STATS || _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			const auto start = std::chrono::steady_clock::now();
+		#endif
+			const int match_code = _pcre2_data_t::match(_code.get(), reinterpret_cast<_sptr_type>(text.data()), text.size(),
+			  offset, opts, match_data, nullptr);
+		#if _PCRE2CPP_HAS_STATS || _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			const auto duration = std::chrono::steady_clock::now() - start;
+		#endif
+		#if _PCRE2CPP_HAS_STATS
+			// failed match (and error) is counted as search of whole text
+			const bool found = match_code >= 0 || match_code == static_cast<int>(match_error_codes::Partial);
+			_record_stats(duration, match_code, offset, found ? _pcre2_data_t::get_ovector_ptr(match_data)[1] : text.size(),
+			  match_data);
+		#endif
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			_record_slow_match(duration, match_code, text, offset, opts);
+		#endif
+			return match_code;
+		}
+
+		/// @brief returns position of first occurrence of literal pattern from offset (call is recorded when statistics are
+		/// enabled, linear search can't be pathological, so it isn't recorded in slow match log)
+		_PCRE2CPP_CONSTEXPR17 size_t _literal_find(const _string_view_type text, const size_t offset) const noexcept {
+		#if _PCRE2CPP_HAS_STATS
+			const auto start = std::chrono::steady_clock::now();
+		#endif
+			const size_t pos = _literal->find(text, offset);
+		#if _PCRE2CPP_HAS_STATS
+			const auto duration = std::chrono::steady_clock::now() - start;
+			const bool found	= pos != _literal_searcher_type::npos;
+			_record_stats(duration, found ? 0 : static_cast<int>(match_error_codes::NoMatch), offset,
+			  found ? pos + _literal->size() : text.size(), nullptr);
+		#endif
+			return pos;
+		}
+
+		/// @brief returns true if literal searcher can be used instead of pcre2 for given subject and options
+		_PCRE2CPP_CONSTEXPR17 bool _use_literal(const _string_view_type text, const size_t offset,
+		  const match_options opts) const noexcept {
+			// bad offset is reported by pcre2
+			return _literal != nullptr && offset <= text.size() && _literal_searcher_type::is_literal_match(opts);
+		}
+
+		/// @brief returns true if partial matching was requested (minimal length can't be used then)
+		static _PCRE2CPP_CONSTEXPR17 bool _is_partial(const match_options opts) noexcept {
+			return (static_cast<uint32_t>(opts) & (PCRE2_PARTIAL_HARD | PCRE2_PARTIAL_SOFT)) != 0;
+		}
+
+		/// @brief returns true if text after offset is too short to contain any match
+		_PCRE2CPP_CONSTEXPR17 bool _is_too_short(const _string_view_type text, const size_t offset) const noexcept {
+			return offset > text.size() || text.size() - offset < _min_length;
+		}
+
+		/// @brief runs anchored match, when there is no match at offset result holds no value (instead of error)
+		template<class Allocator>
+		_PCRE2CPP_CONSTEXPR17 bool _anchored_match(const _string_view_type text, _match_result_t<Allocator>& result,
+		  const size_t offset, const match_options opts) const noexcept {
+				if (match(text, result, offset, opts)) { return true; }
+
+				if (result.get_error_code() == match_error_codes::NoMatch) {
+					result = _match_result_t<Allocator>(offset, _named_sub_values, _code, result.get_allocator());
+				}
+			return false;
+		}
+
+		/// @brief runs match from offset and stores result (with offsets relative to search offset) using its allocator
+		template<class Allocator>
+		_PCRE2CPP_CONSTEXPR20 bool _match_into(const _string_view_type text, _match_result_t<Allocator>& result,
+		  const size_t search_offset, const size_t offset, const match_options opts) const noexcept {
+			using sub_results_type = typename _match_result_t<Allocator>::sub_results_type;
+
+			const Allocator alloc = result.get_allocator();
+				if (_use_literal(text, offset, opts)) {
+					const size_t matchStart = _literal_find(text, offset);
+						if (matchStart == _literal_searcher_type::npos) {
+							result = _match_result_t<Allocator>(match_error_codes::NoMatch, alloc);
+							return false;
+						}
+
+					result = _match_result_t<Allocator>(search_offset,
+					  _match_value_t<Allocator> {
+						  .relative_offset = matchStart - search_offset,
+						  .value		   = _string_t<Allocator>(text.substr(matchStart, _literal->size()), alloc),
+					  },
+					  sub_results_type(alloc), _named_sub_values, _code, alloc);
+					return true;
+				}
+
+			const int match_code = _pcre2_match(text, offset, opts, _match_data.get());
+
+				if (match_code == static_cast<int>(match_error_codes::NoMatch) || match_code <= 0) {
+					result = _match_result_t<Allocator>(static_cast<match_error_codes>(match_code), alloc);
+					return false;
+				}
+
+			const size_t* offsetVector			   = _pcre2_data_t::get_ovector_ptr(_match_data.get());
+			const size_t matchStart				   = offsetVector[0];
+			const size_t matchEnd				   = offsetVector[1];
+			_match_value_t<Allocator> matchValue = {
+				.relative_offset = matchStart - search_offset,
+				.value			 = _string_t<Allocator>(text.substr(matchStart, matchEnd - matchStart), alloc),
+			};
+
+			const size_t offsetVectorsCount = _pcre2_data_t::get_ovector_count(_match_data.get());
+
+			sub_results_type subMatchValues(alloc);
+			subMatchValues.reserve(offsetVectorsCount);
+				for (size_t i = 1; i != offsetVectorsCount; ++i) {
+					const size_t subMatchStart = offsetVector[i * 2];
+					const size_t subMatchEnd   = offsetVector[i * 2 + 1];
+
+						if (subMatchStart == PCRE2_UNSET || subMatchEnd == PCRE2_UNSET) { subMatchValues.emplace_back(); }
+						else {
+							subMatchValues.push_back(sub_match_value {
+								.relative_offset = subMatchStart - matchStart,
+								.size			 = subMatchEnd - subMatchStart,
+							});
+						}
+				}
+
+			result = _match_result_t<Allocator>(search_offset, std::move(matchValue), std::move(subMatchValues),
+			  _named_sub_values, _code, alloc);
+			return true;
+		}
+
+		/**
+		 * @brief finds parts of compiled pattern prone to catastrophic backtracking and keeps them, then rejects pattern or
+		 * returns code recompiled with match limit when check requires it (otherwise code is returned)
+		 */
+		_code_type* _check_backtracking(const _string_view_type pattern, const compile_options opts,
+		  _compile_ctx_type* compile_ctx, const backtracking_check& check, _code_type* code) _PCRE2CPP_NOEXCEPT {
+			std::vector<backtracking_warning> warnings = _backtracking_analyzer_type::analyze(pattern, opts);
+			warnings.erase(std::remove_if(warnings.begin(), warnings.end(),
+							 [&](const backtracking_warning& warning) { return warning.risk < check.min_risk; }),
+			  warnings.end());
+				if (warnings.empty()) { return code; }
+
+			_backtracking_warnings = std::make_shared<const std::vector<backtracking_warning>>(warnings);
+
+				if (check.policy == backtracking_policy::Reject) {
+					const backtracking_warning& warning = warnings.front();
+					const char* growth = warning.risk == backtracking_risk::Exponential ? "exponentially" : "polynomially";
+					const std::string message =
+					  fmt::format("Pattern can backtrack {} at offset {}: {}", growth, warning.offset, warning.reason);
+					_pcre2_data_t::code_free(code);
+		#if !_PCRE2CPP_HAS_EXCEPTIONS
+					pcre2cpp_assert(false, "Failed to initialize code: {}", message);
+					return nullptr;
+		#else
+					throw _regex_exception(_string_type(message.begin(), message.end()));
+		#endif
+				}
+
+				if (check.policy == backtracking_policy::Limit) {
+					// limit set at start of pattern can only lower limit of match context
+					const std::string prefix = fmt::format("(*LIMIT_MATCH={})", check.match_limit);
+					_string_type limited(prefix.begin(), prefix.end());
+					limited.append(pattern);
+
+					int error_code;
+					size_t error_offset;
+					_code_type* limited_code = _pcre2_data_t::compile(reinterpret_cast<_sptr_type>(limited.data()),
+					  limited.size(), opts, &error_code, &error_offset, compile_ctx);
+						if (limited_code != nullptr) {
+							_pcre2_data_t::code_free(code);
+							return limited_code;
+						}
+				}
+			return code;
+		}
+
+		/// @brief runs match with match data which has only one offset pair and returns true if match was found
+		_PCRE2CPP_CONSTEXPR17 bool _min_match(const _string_view_type text, const size_t offset,
+		  const match_options opts) const noexcept {
+			// match data is too small for sub results, so 0 is also returned on success
+			return _pcre2_match(text, offset, opts, _min_match_data.get()) >= 0;
+		}
+
+		/// @brief compiles pattern with given compile context, character tables, general context and backtracking analysis
+		_PCRE2CPP_CONSTEXPR20 basic_regex(const _string_view_type pattern, const compile_options opts,
+		  _compile_ctx_type* compile_ctx, const _tables_ptr& tables, const _general_ctx_ptr& general,
+		  const backtracking_check& check) _PCRE2CPP_NOEXCEPT
+			: _tables(tables), _general(general) {
 			// Compile Code
 			int error_code;
 			size_t error_offset;
 
 			_code_type* code = _pcre2_data_t::compile(reinterpret_cast<_sptr_type>(pattern.data()), pattern.size(), opts,
-			  &error_code, &error_offset, nullptr);
+			  &error_code, &error_offset, compile_ctx);
 
 
 		#if !_PCRE2CPP_HAS_EXCEPTIONS
@@ -84,6 +358,10 @@ namespace pcre2cpp {
 				if (code == nullptr) { throw _regex_exception(error_code, error_offset); }
 		#endif
 
+			// Analyze Backtracking
+				if (check.policy != backtracking_policy::Ignore) {
+					code = _check_backtracking(pattern, opts, compile_ctx, check, code);
+				}
 
 			_code					= std::shared_ptr<_code_type>(code, _pcre2_data_t::code_free);
 
@@ -98,12 +376,14 @@ namespace pcre2cpp {
 			_pcre2_data_t::get_info(_code.get(), PCRE2_INFO_NAMETABLE, &name_table);
 			_pcre2_data_t::get_info(_code.get(), PCRE2_INFO_NAMEENTRYSIZE, &name_entry_size);
 
+			// group number takes 2 code units in 8-bit library and 1 in 16-bit and 32-bit libraries
+			const size_t number_size = utf == utf_type::UTF_8 ? 2 : 1;
 				for (size_t i = 0; i != name_count; ++i) {
-					_uchar_type* entry	   = name_table + i * name_entry_size + 2;
+					_uchar_type* entry	   = name_table + i * name_entry_size + number_size;
 					const int index		   = _pcre2_data_t::substring_number_from_name(_code.get(), entry);
 
 					_uchar_type* entry_end = entry + 1;
-						while (*entry_end != 0 && entry_end - entry < name_entry_size - 3) { entry_end += 1; }
+						while (*entry_end != 0 && entry_end - entry < name_entry_size - number_size - 1) { entry_end += 1; }
 					_named_sub_values->emplace(_string_view_type(reinterpret_cast<_string_char_type*>(entry), entry_end - entry),
 					  static_cast<size_t>(index) - 1);
 				}
@@ -111,8 +391,73 @@ namespace pcre2cpp {
 			// Create Match Data
 			_match_data_type* match_data = _pcre2_data_t::match_data_from_pattern(_code.get(), nullptr);
 			_match_data					 = std::shared_ptr<_match_data_type>(match_data, _pcre2_data_t::match_data_free);
+
+			// match data from pattern uses memory functions of compiled code
+			_match_data_type* min_match_data = _pcre2_data_t::match_data_create(1, _general.get());
+			_min_match_data					 = std::shared_ptr<_match_data_type>(min_match_data, _pcre2_data_t::match_data_free);
+
+			// Get Minimal Match Length
+			_pcre2_data_t::get_info(_code.get(), PCRE2_INFO_MINLENGTH, &_min_length);
+
+			// Check UTF Mode (it can be also set by (*UTF) at start of pattern)
+			uint32_t all_options = 0;
+			_pcre2_data_t::get_info(_code.get(), PCRE2_INFO_ALLOPTIONS, &all_options);
+			_utf = (all_options & PCRE2_UTF) != 0;
+
+			// Create Literal Searcher (caseless matching with locale tables isn't limited to ascii)
+			const bool caseless = (static_cast<uint32_t>(opts) & PCRE2_CASELESS) != 0;
+				if (_literal_searcher_type::is_literal_pattern(pattern, opts) && !(caseless && _tables != nullptr)) {
+					_literal = std::make_shared<const _literal_searcher_type>(pattern, caseless);
+				}
+
+		#if _PCRE2CPP_HAS_STATS
+			// Register Statistics
+			_stats = std::make_shared<regex_stats>(convert_any_utf_to_utf8<utf>(pattern), static_cast<uint32_t>(opts));
+			regex_stats_registry::get_instance().add(_stats);
+		#endif
+
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+			_slow_match_pattern = std::make_shared<const std::string>(convert_any_utf_to_utf8<utf>(pattern));
+		#endif
+		}
+
+		/// @brief parses value of group bound to field and stores it in field, returns false when it can't be parsed
+		template<class T, class Field>
+		_PCRE2CPP_CONSTEXPR17 bool _extract_field(const _match_view_type& view, T& value, const Field& field) const noexcept {
+			static_assert(std::is_same_v<decltype(field.name), _string_view_type>,
+			  "Group name must have the same char type as regex");
+			using member_type = std::remove_reference_t<decltype(value.*(field.member))>;
+
+			const auto it	  = _named_sub_values->find(field.name);
+				if (it == _named_sub_values->end()) { return false; }
+				// unset group leaves default value of field
+				if (!view.has_sub_value(it->second)) { return true; }
+
+			const _string_view_type text = view.get_sub_result_value(it->second);
+				if _PCRE2CPP_CONSTEXPR17 (utils::is_optional_v<member_type>) {
+					value.*(field.member) = utils::parse_value<typename member_type::value_type>(text);
+					return (value.*(field.member)).has_value();
+				}
+				else {
+					const std::optional<member_type> parsed = utils::parse_value<member_type>(text);
+						if (!parsed.has_value()) { return false; }
+					value.*(field.member) = *parsed;
+					return true;
+				}
 		}
 
+	public:
+		/// @brief basic regex container with pattern and compile options
+		_PCRE2CPP_CONSTEXPR20 explicit basic_regex(const _string_view_type pattern,
+		  const compile_options opts = compile_options_bits::None) _PCRE2CPP_NOEXCEPT
+			: basic_regex(pattern, opts, nullptr, nullptr, nullptr, backtracking_check()) {}
+
+		/// @brief basic regex container with pattern compiled using compile context (context can be reused after that)
+		_PCRE2CPP_CONSTEXPR20 basic_regex(const _string_view_type pattern, const _compile_context_type& context,
+		  const compile_options opts = compile_options_bits::None) _PCRE2CPP_NOEXCEPT
+			: basic_regex(pattern, opts, context.get_context(), context.get_tables(), context.get_general_context(),
+				context.get_backtracking_check()) {}
+
 		/// @brief default copy constructor
 		_PCRE2CPP_CONSTEXPR17 basic_regex(const basic_regex& other) noexcept			= default;
 		/// @brief default move constructor
@@ -126,91 +471,377 @@ namespace pcre2cpp {
 		/// @brief default move assign operator
 		_PCRE2CPP_CONSTEXPR17 basic_regex& operator=(basic_regex&& other) noexcept		= default;
 
+		/// @brief returns true if pattern is pure literal and matching uses substring search instead of pcre2
+		_PCRE2CPP_CONSTEXPR17 bool is_literal() const noexcept { return _literal != nullptr; }
+
+		/// @brief returns warnings of backtracking analysis required by compile context (empty when pattern wasn't analyzed)
+		std::vector<backtracking_warning> get_backtracking_warnings() const {
+			return _backtracking_warnings != nullptr ? *_backtracking_warnings : std::vector<backtracking_warning>();
+		}
+
+		#if _PCRE2CPP_HAS_STATS
+		/// @brief returns runtime statistics of regex (summed from all threads and copies of regex)
+		regex_stats_snapshot get_stats() const { return _stats->get_snapshot(); }
+
+		/// @brief sets runtime statistics of regex (and its copies) returned by get_stats to zero (totals exported by
+		/// get_prometheus_stats keep growing)
+		void reset_stats() const noexcept { _stats->reset(); }
+		#endif
+
+		#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+		/// @brief sets threshold above which matches of this regex are recorded in slow match log (instead of threshold of
+		/// log, copies made later keep it)
+		void set_slow_match_threshold(const std::chrono::nanoseconds threshold) noexcept { _slow_match_threshold = threshold; }
+		#endif
+
+		/// @brief returns max count of characters which pattern can look behind start of match attempt (\\b counts as 1)
+		_PCRE2CPP_CONSTEXPR17 size_t get_max_lookbehind() const noexcept {
+			uint32_t max_lookbehind = 0;
+			_pcre2_data_t::get_info(_code.get(), PCRE2_INFO_MAXLOOKBEHIND, &max_lookbehind);
+			return max_lookbehind;
+		}
+
+		/// @brief returns true if pattern is in UTF mode (UTF compile option or (*UTF) at start of pattern)
+		_PCRE2CPP_CONSTEXPR17 bool is_utf() const noexcept { return _utf; }
+
+		/// @brief returns true if pattern can match only at start offset (anchored by compile option or by \\A, \\G or ^
+		/// at start of every alternative)
+		_PCRE2CPP_CONSTEXPR17 bool is_anchored() const noexcept {
+			uint32_t all_options = 0;
+			_pcre2_data_t::get_info(_code.get(), PCRE2_INFO_ALLOPTIONS, &all_options);
+			return (all_options & PCRE2_ANCHORED) != 0;
+		}
+
+		/// @brief returns offset from which search of next match continues after given match (after empty match it skips
+		/// one character, so in UTF mode whole character is skipped)
+		_PCRE2CPP_CONSTEXPR17 size_t get_next_offset(const _string_view_type text, const size_t match_start,
+		  const size_t match_end) const noexcept {
+				if (match_end > match_start) { return match_end; }
+
+			size_t offset = match_start + 1;
+				if (_utf) {
+					while (offset < text.size() && _pcre2_data_t::is_char_continuation(text[offset])) { ++offset; }
+				}
+			return offset;
+		}
+
 		/// @brief returns true if match was found
 		_PCRE2CPP_CONSTEXPR17 bool match(const _string_view_type text, const size_t offset = 0,
 		  const match_options opts = match_options_bits::None) const _PCRE2CPP_NOEXCEPT {
-			const int match_code = _pcre2_data_t::match(_code.get(), reinterpret_cast<_sptr_type>(text.data()), text.size(),
-			  offset, opts, _match_data.get(), nullptr);
+				if (_use_literal(text, offset, opts)) { return _literal_find(text, offset) != _literal_searcher_type::npos; }
+
+			const int match_code = _pcre2_match(text, offset, opts, _match_data.get());
 
 			return match_code != static_cast<int>(match_error_codes::NoMatch) && match_code > 0;
 		}
 
-		/// @brief returns true if match was found and result is stored in result variable
-		_PCRE2CPP_CONSTEXPR20 bool match(const _string_view_type text, _match_result_type& result, const size_t offset = 0,
-		  const match_options opts = match_options_bits::None) const noexcept {
-			const int match_code = _pcre2_data_t::match(_code.get(), reinterpret_cast<_sptr_type>(text.data()), text.size(),
-			  offset, opts, _match_data.get(), nullptr);
+		/// @brief returns true if match was found and result is stored in result variable (allocated with its allocator)
+		template<class Allocator>
+		_PCRE2CPP_CONSTEXPR20 bool match(const _string_view_type text, _match_result_t<Allocator>& result,
+		  const size_t offset = 0, const match_options opts = match_options_bits::None) const noexcept {
+			return _match_into(text, result, offset, offset, opts);
+		}
 
-				if (match_code == static_cast<int>(match_error_codes::NoMatch) || match_code <= 0) {
-					result = _match_result_type(static_cast<match_error_codes>(match_code));
+		/// @brief returns true if match was found and its view is stored in view variable (nothing is copied, view is valid
+		/// until next match with the same regex)
+		_PCRE2CPP_CONSTEXPR17 bool match(const _string_view_type text, _match_view_type& view, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			const int match_code = _pcre2_match(text, offset, opts, _match_data.get());
+				if (match_code <= 0) {
+					view = _match_view_type();
 					return false;
 				}
 
-			const size_t* offsetVector	 = _pcre2_data_t::get_ovector_ptr(_match_data.get());
-			const size_t matchStart		 = offsetVector[0];
-			const size_t matchEnd		 = offsetVector[1];
-			_match_value_type matchValue = {
-				.relative_offset = matchStart - offset,
-				.value			 = _string_type(text.substr(matchStart, matchEnd - matchStart)),
-			};
+			view = _match_view_type(text, _pcre2_data_t::get_ovector_ptr(_match_data.get()),
+			  _pcre2_data_t::get_ovector_count(_match_data.get()), _named_sub_values.get());
+			return true;
+		}
 
-			const size_t offsetVectorsCount = _pcre2_data_t::get_ovector_count(_match_data.get());
+		/// @brief returns true if match was found, and it has relative offset == 0 (uses PCRE2_ANCHORED)
+		_PCRE2CPP_CONSTEXPR17 bool match_at(const _string_view_type text, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+				if (!_is_partial(opts) && _is_too_short(text, offset)) { return false; }
+			return _min_match(text, offset, opts | match_options_bits::Anchored);
+		}
 
-			std::vector<std::optional<sub_match_value> > subMatchValues;
-			subMatchValues.reserve(offsetVectorsCount);
-				for (size_t i = 1; i != offsetVectorsCount; ++i) {
-					const size_t subMatchStart = offsetVector[i * 2];
-					const size_t subMatchEnd   = offsetVector[i * 2 + 1];
+		/// @brief returns true if match was found, and it has relative offset == 0 and result is stored in result variable
+		/// (uses PCRE2_ANCHORED)
+		template<class Allocator>
+		_PCRE2CPP_CONSTEXPR17 bool match_at(const _string_view_type text, _match_result_t<Allocator>& result,
+		  const size_t offset = 0, const match_options opts = match_options_bits::None) const noexcept {
+			return _anchored_match(text, result, offset, opts | match_options_bits::Anchored);
+		}
 
-						if (subMatchStart == PCRE2_UNSET || subMatchEnd == PCRE2_UNSET) { subMatchValues.emplace_back(); }
-						else {
-							subMatchValues.push_back(sub_match_value {
-								.relative_offset = subMatchStart - matchStart,
-								.size			 = subMatchEnd - subMatchStart,
-							});
+		/// @brief returns true if match was found which starts at offset and ends at the end of text (uses PCRE2_ANCHORED and
+		/// PCRE2_ENDANCHORED)
+		_PCRE2CPP_CONSTEXPR17 bool full_match(const _string_view_type text, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+				if (!_is_partial(opts) && _is_too_short(text, offset)) { return false; }
+			return _min_match(text, offset, opts | match_options_bits::Anchored | match_options_bits::EndAnchored);
+		}
+
+		/// @brief returns true if match was found which starts at offset and ends at the end of text and result is stored in
+		/// result variable (uses PCRE2_ANCHORED and PCRE2_ENDANCHORED)
+		template<class Allocator>
+		_PCRE2CPP_CONSTEXPR17 bool full_match(const _string_view_type text, _match_result_t<Allocator>& result,
+		  const size_t offset = 0, const match_options opts = match_options_bits::None) const noexcept {
+			return _anchored_match(text, result, offset, opts | match_options_bits::Anchored | match_options_bits::EndAnchored);
+		}
+
+		/// @brief returns true if any match was found and all results store in results array (results are created in place,
+		/// so with allocator aware vector, e.g. std::pmr::vector, they use its allocator)
+		template<class Allocator, class VectorAllocator>
+		_PCRE2CPP_CONSTEXPR20 bool match_all(const _string_view_type text,
+		  std::vector<_match_result_t<Allocator>, VectorAllocator>& results, size_t offset = 0) const noexcept {
+			const size_t start_offset = offset;
+			match_options opts		  = match_options_bits::None;
+			results.emplace_back();
+				while (_match_into(text, results.back(), start_offset, offset, opts)) {
+					const auto& result		 = results.back();
+					const size_t match_start = start_offset + result.get_result_relative_offset();
+					offset					 = get_next_offset(text, match_start, match_start + result.get_result_size());
+					// subject was checked by first match
+					opts					 = match_options_bits::NoUTFCheck;
+					results.emplace_back();
+				}
+			results.pop_back();
+
+			return results.size() != 0;
+		}
+
+		/// @brief returns true if any match was found and all matches are stored in batch (it copies text once and stores
+		/// offsets of all matches in one array, reuse batch to keep its capacity)
+		_PCRE2CPP_CONSTEXPR20 bool match_all(const _string_view_type text, _match_batch_type& batch,
+		  const size_t offset = 0) const noexcept {
+			return match_all(std::make_shared<const _string_type>(text), batch, offset);
+		}
+
+		/// @brief returns true if any match was found and all matches are stored in batch (batch shares subject instead of
+		/// copying it)
+		_PCRE2CPP_CONSTEXPR20 bool match_all(const _subject_ptr& subject, _match_batch_type& batch,
+		  size_t offset = 0) const noexcept {
+			batch.reset(subject, _pcre2_data_t::get_ovector_count(_match_data.get()), _named_sub_values, _code);
+				if (subject == nullptr) { return false; }
+
+			const _string_view_type text = *subject;
+				if (_use_literal(text, offset, match_options_bits::None)) {
+					size_t offsets[2] = { _literal_find(text, offset), 0 };
+						while (offsets[0] != _literal_searcher_type::npos) {
+							offsets[1] = offsets[0] + _literal->size();
+							batch.push_back(offsets);
+							offsets[0] = _literal_find(text, offsets[1]);
 						}
+					return !batch.empty();
 				}
 
-			result = _match_result_type(offset, matchValue, subMatchValues, _named_sub_values, _code);
-			return true;
+			const size_t* offsetVector = _pcre2_data_t::get_ovector_ptr(_match_data.get());
+			match_options opts		   = match_options_bits::None;
+				while (_pcre2_match(text, offset, opts, _match_data.get()) > 0) {
+					batch.push_back(offsetVector);
+					offset = get_next_offset(text, offsetVector[0], offsetVector[1]);
+					// subject was checked by first match
+					opts   = match_options_bits::NoUTFCheck;
+				}
+
+			return !batch.empty();
 		}
 
-		/// @brief returns true if match was found, and it has relative offset == 0
-		_PCRE2CPP_CONSTEXPR17 bool match_at(const _string_view_type text, const size_t offset = 0) const noexcept {
-			_match_result_type result;
-			return match_at(text, result, offset);
+		/// @brief returns true if any match was found (no result is created)
+		_PCRE2CPP_CONSTEXPR17 bool any_match(const _string_view_type text, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+				if (!_is_partial(opts) && _is_too_short(text, offset)) { return false; }
+				if (_use_literal(text, offset, opts)) { return _literal_find(text, offset) != _literal_searcher_type::npos; }
+			return _min_match(text, offset, opts);
 		}
 
-		/// @brief returns true if match was found, and it has relative offset == 0 and result is stored in result variable
-		_PCRE2CPP_CONSTEXPR17 bool match_at(const _string_view_type text, _match_result_type& result,
-		  const size_t offset = 0) const noexcept {
-				if (!match(text, result, offset)) { return false; }
+		/**
+		 * @brief finds first match from offset and stores only its offsets (no result is created)
+		 * @param text text to match
+		 * @param match_start offset of beginning of match from the beginning of text
+		 * @param match_end offset of end of match from the beginning of text
+		 * @param offset offset from which search starts
+		 * @param opts match options
+		 * @return true if match was found
+		 */
+		_PCRE2CPP_CONSTEXPR17 bool find(const _string_view_type text, size_t& match_start, size_t& match_end,
+		  const size_t offset = 0, const match_options opts = match_options_bits::None) const noexcept {
+			return try_find(text, match_start, match_end, offset, opts) == match_error_codes::None;
+		}
 
-				if (result.get_result_relative_offset() != 0) {
-					result = _match_result_type(offset, _named_sub_values, _code);
-					return false;
+		/**
+		 * @brief finds first match from offset like find, but returns error code of match
+		 * @param text text to match
+		 * @param match_start offset of beginning of match (or partial match) from the beginning of text
+		 * @param match_end offset of end of match (or partial match) from the beginning of text
+		 * @param offset offset from which search starts
+		 * @param opts match options
+		 * @return match_error_codes::None when match was found, match_error_codes::Partial when partial match was requested
+		 * and found or other error code (e.g. match_error_codes::NoMatch or match_error_codes::MatchLimit)
+		 */
+		_PCRE2CPP_CONSTEXPR17 match_error_codes try_find(const _string_view_type text, size_t& match_start,
+		  size_t& match_end, const size_t offset = 0, const match_options opts = match_options_bits::None) const noexcept {
+				if (!_is_partial(opts) && _is_too_short(text, offset)) { return match_error_codes::NoMatch; }
+				if (_use_literal(text, offset, opts)) {
+					match_start = _literal_find(text, offset);
+						if (match_start == _literal_searcher_type::npos) { return match_error_codes::NoMatch; }
+					match_end = match_start + _literal->size();
+					return match_error_codes::None;
 				}
 
-			return true;
+			const int match_code = _pcre2_match(text, offset, opts, _min_match_data.get());
+				if (match_code < 0 && match_code != static_cast<int>(match_error_codes::Partial)) {
+					return static_cast<match_error_codes>(match_code);
+				}
+
+			const size_t* offsetVector = _pcre2_data_t::get_ovector_ptr(_min_match_data.get());
+			match_start				   = offsetVector[0];
+			match_end				   = offsetVector[1];
+			return match_code < 0 ? match_error_codes::Partial : match_error_codes::None;
 		}
 
-		/// @brief returns true if any match was found and all results store in results array
-		_PCRE2CPP_CONSTEXPR17 bool match_all(const _string_view_type text, std::vector<_match_result_type>& results,
-		  size_t offset = 0) const noexcept {
-			size_t start_offset = offset;
-			_match_result_type result;
-				while (match(text, result, offset)) {
-					results.emplace_back(start_offset,
-					  _match_value_type {
-						  .relative_offset = offset - start_offset + result.get_result_relative_offset(),
-						  .value		   = result.get_result_value(),
-					  },
-					  result.get_sub_results(), _named_sub_values, _code);
+		/**
+		 * @brief finds first match from offset like find, but also reports partial match at the end of text (uses
+		 * PCRE2_PARTIAL_HARD, so it is used to match subject delivered in parts)
+		 * @param text text to match
+		 * @param match_start offset of beginning of match (or partial match) from the beginning of text
+		 * @param match_end offset of end of match (or partial match) from the beginning of text
+		 * @param offset offset from which search starts
+		 * @param opts match options
+		 * @return match_error_codes::None when match was found, match_error_codes::Partial when text ended before match
+		 * could be finished or other error code (e.g. match_error_codes::NoMatch)
+		 */
+		_PCRE2CPP_CONSTEXPR17 match_error_codes find_partial(const _string_view_type text, size_t& match_start,
+		  size_t& match_end, const size_t offset = 0, const match_options opts = match_options_bits::None) const noexcept {
+			return try_find(text, match_start, match_end, offset, opts | match_options_bits::PartialHard);
+		}
 
-					offset += result.get_result_relative_offset() + result.get_result_size();
+		/// @brief returns count of all matches found in text (no results are created)
+		_PCRE2CPP_CONSTEXPR17 size_t count_matches(const _string_view_type text, size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			size_t count = 0;
+				if (_use_literal(text, offset, opts)) {
+					size_t pos = _literal_find(text, offset);
+						while (pos != _literal_searcher_type::npos) {
+							++count;
+							pos = _literal_find(text, pos + _literal->size());
+						}
+					return count;
 				}
 
-			return results.size() != 0;
+			const bool use_min_length = !_is_partial(opts);
+			match_options match_opts  = opts;
+				while (!(use_min_length && _is_too_short(text, offset)) && _min_match(text, offset, match_opts)) {
+					const size_t* offsetVector = _pcre2_data_t::get_ovector_ptr(_min_match_data.get());
+
+					++count;
+					offset	   = get_next_offset(text, offsetVector[0], offsetVector[1]);
+					// subject was checked by first match
+					match_opts = opts | match_options_bits::NoUTFCheck;
+				}
+
+			return count;
+		}
+
+		/**
+		 * @brief streams text from offset to out with every match replaced by output of callable
+		 * @tparam OutputIt output iterator of char type
+		 * @tparam Callable callable which takes match view and returns value convertible to string view or which takes
+		 * match view and output iterator and returns output iterator after writing replacement
+		 * @return output iterator after last written char
+		 * @note match errors other than match_error_codes::NoMatch (e.g. match_error_codes::MatchLimit) fail assert or
+		 * throw regex exception when exceptions are enabled
+		 */
+		template<class OutputIt, class Callable>
+		OutputIt replace_with(const _string_view_type text, OutputIt out, Callable&& callable, size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const {
+			size_t copied			 = 0;
+			match_options match_opts = opts;
+				while (offset <= text.size()) {
+					const int match_code = _pcre2_match(text, offset, match_opts, _match_data.get());
+
+						if (match_code == static_cast<int>(match_error_codes::NoMatch)) { break; }
+		#if !_PCRE2CPP_HAS_EXCEPTIONS
+					pcre2cpp_assert(match_code > 0, "Failed to replace matches: {}",
+					  convert_any_utf_to_utf8<utf>(generate_error_message<utf>(match_code)));
+						if (match_code <= 0) { break; }
+		#else
+						if (match_code <= 0) { throw _regex_exception(match_code); }
+		#endif
+
+					const size_t* offsetVector = _pcre2_data_t::get_ovector_ptr(_match_data.get());
+					const size_t matchStart	   = offsetVector[0];
+					const size_t matchEnd	   = offsetVector[1];
+
+					out						   = std::copy(text.begin() + copied, text.begin() + matchStart, out);
+
+					const _match_view_type view(text, offsetVector, _pcre2_data_t::get_ovector_count(_match_data.get()),
+					  _named_sub_values.get());
+						if _PCRE2CPP_CONSTEXPR17 (std::is_invocable_r_v<OutputIt, Callable&, const _match_view_type&, OutputIt>) {
+							out = callable(view, out);
+						}
+						else {
+							// result is bound to reference so returned string lives until it is copied
+							auto&& result						= callable(view);
+							const _string_view_type replacement = result;
+							out									= std::copy(replacement.begin(), replacement.end(), out);
+						}
+
+					copied	   = matchEnd;
+					offset	   = get_next_offset(text, matchStart, matchEnd);
+					// subject was checked by first match
+					match_opts = opts | match_options_bits::NoUTFCheck;
+				}
+
+			return std::copy(text.begin() + copied, text.end(), out);
+		}
+
+		/**
+		 * @brief matches text and parses named groups into fields of T (mapped by extraction_traits<T>) without allocation.
+		 * Unset groups leave default values of fields, string view fields reference text
+		 * @tparam T default constructible struct type
+		 * @param text text to match
+		 * @param offset offset from which search starts
+		 * @param opts match options
+		 * @return extracted struct or nullopt when there is no match or any value can't be parsed
+		 */
+		template<class T>
+		_PCRE2CPP_CONSTEXPR20 std::optional<T> extract(const _string_view_type text, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			const int match_code = _pcre2_match(text, offset, opts, _match_data.get());
+				if (match_code <= 0) { return std::nullopt; }
+
+			const _match_view_type view(text, _pcre2_data_t::get_ovector_ptr(_match_data.get()),
+			  static_cast<size_t>(match_code), _named_sub_values.get());
+
+			T value {};
+			const bool extracted = std::apply(
+			  [&](const auto&... fields) { return (_extract_field(view, value, fields) && ...); },
+			  extraction_traits<T>::fields);
+				if (!extracted) { return std::nullopt; }
+			return value;
+		}
+
+		/**
+		 * @brief matches every row and fills batch with one column per named group (values aren't copied)
+		 * @param rows rows to match (batch references them)
+		 * @param batch batch which is cleared and filled (reuse it to avoid allocations)
+		 * @param opts match options
+		 * @return count of matched rows
+		 */
+		_PCRE2CPP_CONSTEXPR20 size_t extract_columns(const std::vector<_string_view_type>& rows, _column_batch_type& batch,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			batch.reset(*_named_sub_values, rows);
+
+			const size_t* offsetVector = _pcre2_data_t::get_ovector_ptr(_match_data.get());
+			size_t matched			   = 0;
+				for (size_t row = 0; row != rows.size(); ++row) {
+					const int match_code = _pcre2_match(rows[row], 0, opts, _match_data.get());
+						if (match_code <= 0) { continue; }
+
+					batch.set_row(row, offsetVector, static_cast<size_t>(match_code));
+					++matched;
+				}
+			return matched;
 		}
 	};
 
@@ -226,12 +857,24 @@ namespace pcre2cpp {
 
 	using regex = basic_regex<default_utf_type>;
 
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_regex<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_regex<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_regex<utf_type::UTF_32>;
+			#endif
+		#endif
+
 	template<utf_type utf = default_utf_type>
 	bool is_pattern_valid(const typename utils::pcre2_data<utf>::string_view_type pattern,
 	  const compile_options opts = compile_options_bits::None) noexcept {
 		using pcre2_data_t = utils::pcre2_data<utf>;
 		using code_t	   = typename pcre2_data_t::code_type;
-		using sptr_t	   = pcre2_data_t::sptr_type;
+		using sptr_t	   = typename pcre2_data_t::sptr_type;
 
 		// Compile Code
 		int error_code;
@@ -245,6 +888,34 @@ namespace pcre2cpp {
 		pcre2_data_t::code_free(code);
 		return true;
 	}
+
+	/**
+	 * @brief checks if pattern can be compiled with given compile context (e.g. if it doesn't exceed its limits)
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 * @param pattern regex pattern
+	 * @param context compile context
+	 * @param opts compile options
+	 * @return true if pattern is valid
+	 */
+	template<utf_type utf = default_utf_type>
+	bool is_pattern_valid(const typename utils::pcre2_data<utf>::string_view_type pattern,
+	  const basic_compile_context<utf>& context, const compile_options opts = compile_options_bits::None) noexcept {
+		using pcre2_data_t = utils::pcre2_data<utf>;
+		using code_t	   = typename pcre2_data_t::code_type;
+		using sptr_t	   = typename pcre2_data_t::sptr_type;
+
+		int error_code;
+		size_t error_offset;
+
+		code_t* code = pcre2_data_t::compile(reinterpret_cast<sptr_t>(pattern.data()), pattern.size(), opts, &error_code,
+		  &error_offset, context.get_context());
+
+			if (code == nullptr) { return false; }
+
+		pcre2_data_t::code_free(code);
+		return true;
+	}
 } // namespace pcre2cpp
 	#endif
 #endif
\ No newline at end of file
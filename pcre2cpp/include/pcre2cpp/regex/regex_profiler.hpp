@@ -0,0 +1,276 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_REGEX_PROFILER_HPP_
+	#define _PCRE2CPP_REGEX_PROFILER_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/exceptions/exceptions.hpp>
+		#include <pcre2cpp/match/match_error_codes.hpp>
+		#include <pcre2cpp/match/match_options.hpp>
+		#include <pcre2cpp/regex/compile_options.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Profile of one item of pattern
+	 * @ingroup pcre2cpp
+	 */
+	struct pattern_item_profile {
+		/// @brief offset of item in pattern (in code units)
+		size_t pattern_offset = 0;
+		/// @brief length of item in pattern (0 for end of pattern)
+		size_t length		  = 0;
+		/// @brief count of times matching entered item
+		size_t entered		  = 0;
+		/// @brief count of times matching continued at item after backtracking
+		size_t backtracks	  = 0;
+	};
+
+	/**
+	 * @brief Profile of pattern collected by regex profiler
+	 * @ingroup pcre2cpp
+	 */
+	struct regex_profile {
+		/// @brief count of profiled match calls
+		size_t match_calls	   = 0;
+		/// @brief count of positions at which match attempt started
+		size_t start_positions = 0;
+		/// @brief count of all entered items
+		size_t entered		   = 0;
+		/// @brief count of all backtracks
+		size_t backtracks	   = 0;
+		/// @brief count of match calls stopped by match, depth or heap limit
+		size_t limit_errors	   = 0;
+		/// @brief profiles of entered items sorted by offset in pattern
+		std::vector<pattern_item_profile> items;
+	};
+
+	/**
+	 * @brief Profiler of pattern. Pattern is compiled with automatic callouts before every item and counting callout
+	 * is installed in match context, so it is much slower than basic_regex and only meant to find hot spots of slow
+	 * patterns (basic_regex isn't affected by it). Profiler isn't thread safe
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_regex_profiler {
+	private:
+		using _pcre2_data_t		= utils::pcre2_data<utf>;
+
+		using _code_type		= typename _pcre2_data_t::code_type;
+		using _code_ptr			= std::shared_ptr<_code_type>;
+		using _match_data_type	= typename _pcre2_data_t::match_data_type;
+		using _match_data_ptr	= std::shared_ptr<_match_data_type>;
+		using _match_ctx_type	= typename _pcre2_data_t::match_ctx_type;
+		using _match_ctx_ptr	= std::shared_ptr<_match_ctx_type>;
+		using _callout_block	= typename _pcre2_data_t::callout_block_type;
+		using _string_type		= typename _pcre2_data_t::string_type;
+		using _string_view_type = typename _pcre2_data_t::string_view_type;
+		using _sptr_type		= typename _pcre2_data_t::sptr_type;
+		#if _PCRE2CPP_HAS_EXCEPTIONS
+		using _regex_exception = basic_regex_exception<utf>;
+		#endif
+
+		/// @brief profiled pattern
+		_string_type _pattern;
+		/// @brief pointer to compiled pcre2 code with automatic callouts
+		_code_ptr _code				= nullptr;
+		/// @brief pointer to match data of pcre2 code
+		_match_data_ptr _match_data = nullptr;
+		/// @brief pointer to match context with counting callout
+		_match_ctx_ptr _match_ctx	= nullptr;
+		/// @brief true if pattern was compiled in UTF mode (empty matches are skipped by whole characters)
+		bool _utf					= false;
+		/// @brief collected profile without items
+		regex_profile _profile;
+		/// @brief profiles of items indexed by offset in pattern (items which weren't entered have 0 entries)
+		std::vector<pattern_item_profile> _items;
+
+		/// @brief callout called before every item of pattern
+		static int _count_callout(_callout_block* block, void* data) noexcept {
+			auto* profiler = static_cast<basic_regex_profiler*>(data);
+				if (block->pattern_position >= profiler->_items.size()) { return 0; }
+
+			pattern_item_profile& item = profiler->_items[block->pattern_position];
+			item.pattern_offset		   = block->pattern_position;
+			item.length				   = block->next_item_length;
+			++item.entered;
+			++profiler->_profile.entered;
+
+				// backtrack flag is also set for first callout at new start position, which is counted separately
+				if ((block->callout_flags & PCRE2_CALLOUT_STARTMATCH) != 0) { ++profiler->_profile.start_positions; }
+				else if ((block->callout_flags & PCRE2_CALLOUT_BACKTRACK) != 0) {
+					++item.backtracks;
+					++profiler->_profile.backtracks;
+				}
+			return 0;
+		}
+
+		/// @brief runs profiled match and returns pcre2 match code
+		int _match(const _string_view_type text, const size_t offset, const match_options opts) noexcept {
+			++_profile.match_calls;
+			const int match_code = _pcre2_data_t::match(_code.get(), reinterpret_cast<_sptr_type>(text.data()), text.size(),
+			  offset, opts, _match_data.get(), _match_ctx.get());
+				if (match_code == static_cast<int>(match_error_codes::MatchLimit) ||
+					match_code == static_cast<int>(match_error_codes::DepthLimit) ||
+					match_code == static_cast<int>(match_error_codes::HeapLimit)) {
+					++_profile.limit_errors;
+				}
+			return match_code;
+		}
+
+	public:
+		/// @brief profiler of pattern compiled with compile options (compile errors are reported like by basic_regex)
+		_PCRE2CPP_CONSTEXPR20 explicit basic_regex_profiler(const _string_view_type pattern,
+		  const compile_options opts = compile_options_bits::None) _PCRE2CPP_NOEXCEPT
+			: _pattern(pattern), _items(pattern.size() + 1) {
+			// Compile Code
+			int error_code;
+			size_t error_offset;
+
+			_code_type* code = _pcre2_data_t::compile(reinterpret_cast<_sptr_type>(pattern.data()), pattern.size(),
+			  opts | compile_options_bits::AutoCallout, &error_code, &error_offset, nullptr);
+
+		#if !_PCRE2CPP_HAS_EXCEPTIONS
+			pcre2cpp_assert(code != nullptr, "Failed to initialize code: {}",
+			  convert_any_utf_to_utf8<utf>(generate_error_message<utf>(error_code, error_offset)));
+		#else
+				if (code == nullptr) { throw _regex_exception(error_code, error_offset); }
+		#endif
+
+			_code						 = _code_ptr(code, _pcre2_data_t::code_free);
+
+			uint32_t all_options		 = 0;
+			_pcre2_data_t::get_info(_code.get(), PCRE2_INFO_ALLOPTIONS, &all_options);
+			_utf						 = (all_options & PCRE2_UTF) != 0;
+
+			// Create Match Data and Match Context
+			_match_data_type* match_data = _pcre2_data_t::match_data_from_pattern(_code.get(), nullptr);
+			_match_data					 = _match_data_ptr(match_data, _pcre2_data_t::match_data_free);
+
+			_match_ctx_type* match_ctx	 = _pcre2_data_t::match_ctx_create(nullptr);
+			_match_ctx					 = _match_ctx_ptr(match_ctx, _pcre2_data_t::match_ctx_free);
+			_pcre2_data_t::set_callout(_match_ctx.get(), &_count_callout, this);
+		}
+
+		// callout data points to profiler, so it can't be copied or moved
+		basic_regex_profiler(const basic_regex_profiler& other)			   = delete;
+		basic_regex_profiler(basic_regex_profiler&& other)				   = delete;
+		basic_regex_profiler& operator=(const basic_regex_profiler& other) = delete;
+		basic_regex_profiler& operator=(basic_regex_profiler&& other)	   = delete;
+
+		/// @brief default destructor
+		_PCRE2CPP_CONSTEXPR20 ~basic_regex_profiler() noexcept			   = default;
+
+		/// @brief returns profiled pattern
+		_PCRE2CPP_CONSTEXPR17 _string_view_type get_pattern() const noexcept { return _pattern; }
+
+		/// @brief profiles one match call, returns true if match was found
+		bool match(const _string_view_type text, const size_t offset = 0,
+		  const match_options opts = match_options_bits::None) noexcept {
+			return _match(text, offset, opts) > 0;
+		}
+
+		/// @brief profiles search of all matches in text (like basic_regex::count_matches), returns count of matches
+		size_t count_matches(const _string_view_type text, size_t offset = 0,
+		  const match_options opts = match_options_bits::None) noexcept {
+			size_t count			 = 0;
+			match_options match_opts = opts;
+				while (offset <= text.size() && _match(text, offset, match_opts) > 0) {
+					const size_t* offsetVector = _pcre2_data_t::get_ovector_ptr(_match_data.get());
+					++count;
+					offset = offsetVector[1] > offsetVector[0] ? offsetVector[1] : offsetVector[0] + 1;
+						// empty match is skipped by whole character
+						while (_utf && offset < text.size() && _pcre2_data_t::is_char_continuation(text[offset])) { ++offset; }
+					// subject was checked by first match
+					match_opts = opts | match_options_bits::NoUTFCheck;
+				}
+			return count;
+		}
+
+		/// @brief returns profile collected since construction or last reset
+		regex_profile get_profile() const {
+			regex_profile profile = _profile;
+				for (const pattern_item_profile& item : _items) {
+						if (item.entered != 0) { profile.items.push_back(item); }
+				}
+			return profile;
+		}
+
+		/// @brief clears collected profile
+		void reset() noexcept {
+			_profile = regex_profile();
+			std::fill(_items.begin(), _items.end(), pattern_item_profile());
+		}
+
+		/**
+		 * @brief returns collected profile as text table (UTF-8) with items sorted by count of backtracks and entries
+		 * @param max_items maximal count of listed items
+		 */
+		std::string get_report(const size_t max_items = std::numeric_limits<size_t>::max()) const {
+			regex_profile profile = get_profile();
+			std::stable_sort(profile.items.begin(), profile.items.end(),
+			  [](const pattern_item_profile& a, const pattern_item_profile& b) {
+				  return a.backtracks != b.backtracks ? a.backtracks > b.backtracks : a.entered > b.entered;
+			  });
+
+			std::string report = fmt::format("pattern: {}\ncalls: {}, start positions: {}, entered: {}, backtracks: {}, "
+											 "limit errors: {}\n{:>8} {:>12} {:>12}  item\n",
+			  convert_any_utf_to_utf8<utf>(_pattern), profile.match_calls, profile.start_positions, profile.entered,
+			  profile.backtracks, profile.limit_errors, "offset", "entered", "backtracks");
+
+				for (size_t i = 0; i != profile.items.size() && i != max_items; ++i) {
+					const pattern_item_profile& item = profile.items[i];
+					const _string_view_type item_text = _string_view_type(_pattern).substr(item.pattern_offset, item.length);
+					report += fmt::format("{:>8} {:>12} {:>12}  {}\n", item.pattern_offset, item.entered, item.backtracks,
+					  item.length == 0 ? std::string("<end>") : convert_any_utf_to_utf8<utf>(item_text));
+				}
+			return report;
+		}
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8regex_profiler = basic_regex_profiler<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16regex_profiler = basic_regex_profiler<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32regex_profiler = basic_regex_profiler<utf_type::UTF_32>;
+		#endif
+
+	using regex_profiler = basic_regex_profiler<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_regex_profiler<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_regex_profiler<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_regex_profiler<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
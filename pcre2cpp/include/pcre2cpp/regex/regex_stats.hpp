@@ -0,0 +1,395 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_REGEX_STATS_HPP_
+	#define _PCRE2CPP_REGEX_STATS_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#elif !_PCRE2CPP_HAS_STATS
+_PCRE2CPP_ERROR("This is only available when PCRE2CPP_ENABLE_STATS is defined!");
+	#else
+
+		#include <pcre2cpp/match/match_error_codes.hpp>
+		#include <pcre2cpp/types.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Count of buckets of latency histogram. Bucket i counts match calls which took less than 2^i ns (and at least
+	 * 2^(i-1) ns), the last one counts all longer calls
+	 * @ingroup pcre2cpp
+	 */
+	static _PCRE2CPP_CONSTEXPR17 size_t regex_stats_buckets_count = 32;
+
+	/**
+	 * @brief Statistics of regex aggregated from all threads
+	 * @ingroup pcre2cpp
+	 */
+	struct regex_stats_snapshot {
+		/// @brief pattern of regex (converted to UTF-8)
+		std::string pattern;
+		/// @brief compile options of regex
+		uint32_t options			 = 0;
+		/// @brief count of match calls (pcre2 match or literal search)
+		uint64_t calls				 = 0;
+		/// @brief count of calls which found match (or partial match)
+		uint64_t matches			 = 0;
+		/// @brief count of calls which found no match
+		uint64_t misses				 = 0;
+		/// @brief count of calls stopped by match, depth or heap limit
+		uint64_t limit_errors		 = 0;
+		/// @brief count of calls which ended with other error
+		uint64_t other_errors		 = 0;
+		/// @brief count of subject characters searched (from offset to end of match or end of subject)
+		uint64_t chars_scanned		 = 0;
+		/// @brief summed time of all calls in nanoseconds
+		uint64_t total_ns			 = 0;
+		/// @brief maximal size of pcre2 heap frames after match in bytes (0 when pcre2 doesn't report it)
+		uint64_t max_heap_frames_size = 0;
+		/// @brief latency histogram (see regex_stats_buckets_count)
+		std::array<uint64_t, regex_stats_buckets_count> latency_buckets = {};
+
+		/// @brief returns true if snapshot is of regex with the same pattern and compile options as other
+		bool is_same_regex(const regex_stats_snapshot& other) const noexcept {
+			return options == other.options && pattern == other.pattern;
+		}
+
+		/// @brief returns true if snapshot is ordered before other by pattern and compile options
+		bool is_before(const regex_stats_snapshot& other) const noexcept {
+			return pattern != other.pattern ? pattern < other.pattern : options < other.options;
+		}
+
+		/// @brief adds counters of other snapshot (e.g. of other regex with the same pattern)
+		void merge(const regex_stats_snapshot& other) noexcept {
+			calls				 += other.calls;
+			matches				 += other.matches;
+			misses				 += other.misses;
+			limit_errors		 += other.limit_errors;
+			other_errors		 += other.other_errors;
+			chars_scanned		 += other.chars_scanned;
+			total_ns			 += other.total_ns;
+			max_heap_frames_size  = std::max(max_heap_frames_size, other.max_heap_frames_size);
+				for (size_t i = 0; i != regex_stats_buckets_count; ++i) { latency_buckets[i] += other.latency_buckets[i]; }
+		}
+	};
+
+	/**
+	 * @brief Runtime statistics of one regex (shared by its copies). Every thread writes only to its own shard of relaxed
+	 * atomic counters (threads are assigned to shards in turns), so recording doesn't lock, and shards are summed on read.
+	 * Counters only grow, reset only moves base which is subtracted from snapshots of regex
+	 * @ingroup pcre2cpp
+	 */
+	class regex_stats {
+	private:
+		/// @brief count of shards (threads above it share shards)
+		static constexpr size_t _shards_count = 16;
+
+		/// @brief counters of one thread (on separate cache line)
+		struct alignas(64) _shard {
+			std::atomic<uint64_t> calls				   = 0;
+			std::atomic<uint64_t> matches			   = 0;
+			std::atomic<uint64_t> misses			   = 0;
+			std::atomic<uint64_t> limit_errors		   = 0;
+			std::atomic<uint64_t> other_errors		   = 0;
+			std::atomic<uint64_t> chars_scanned		   = 0;
+			std::atomic<uint64_t> total_ns			   = 0;
+			std::atomic<uint64_t> max_heap_frames_size = 0;
+			std::array<std::atomic<uint64_t>, regex_stats_buckets_count> latency_buckets = {};
+		};
+
+		/// @brief pattern of regex
+		std::string _pattern;
+		/// @brief compile options of regex
+		uint32_t _options;
+		/// @brief counters of threads
+		std::array<_shard, _shards_count> _shards;
+		/// @brief totals at last reset
+		regex_stats_snapshot _reset_base;
+		/// @brief guards reset base
+		mutable std::mutex _reset_mutex;
+
+		/// @brief returns shard of current thread
+		_shard& _get_shard() noexcept {
+			static std::atomic<size_t> next_shard	 = 0;
+			static thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % _shards_count;
+			return _shards[shard];
+		}
+
+		/// @brief returns index of latency bucket
+		static size_t _get_bucket(uint64_t ns) noexcept {
+			size_t bucket = 0;
+				while (ns != 0 && bucket + 1 < regex_stats_buckets_count) {
+					ns >>= 1;
+					++bucket;
+				}
+			return bucket;
+		}
+
+	public:
+		/// @brief statistics of regex with given pattern (UTF-8) and compile options
+		regex_stats(std::string pattern, const uint32_t options) noexcept : _pattern(std::move(pattern)), _options(options) {}
+
+		/// @brief returns pattern of regex (UTF-8)
+		const std::string& get_pattern() const noexcept { return _pattern; }
+
+		/**
+		 * @brief records one match call
+		 * @param match_code result of pcre2 match (or 0 and match_error_codes::NoMatch for literal search)
+		 * @param chars count of searched characters
+		 * @param ns duration of call in nanoseconds
+		 * @param heap_frames_size size of pcre2 heap frames after call
+		 */
+		void record(const int match_code, const size_t chars, const uint64_t ns, const size_t heap_frames_size) noexcept {
+			_shard& shard = _get_shard();
+			shard.calls.fetch_add(1, std::memory_order_relaxed);
+
+				switch (static_cast<match_error_codes>(match_code)) {
+					case match_error_codes::NoMatch: shard.misses.fetch_add(1, std::memory_order_relaxed); break;
+					case match_error_codes::Partial: shard.matches.fetch_add(1, std::memory_order_relaxed); break;
+					case match_error_codes::MatchLimit:
+					case match_error_codes::DepthLimit:
+					case match_error_codes::HeapLimit: shard.limit_errors.fetch_add(1, std::memory_order_relaxed); break;
+					default:
+							if (match_code >= 0) { shard.matches.fetch_add(1, std::memory_order_relaxed); }
+							else { shard.other_errors.fetch_add(1, std::memory_order_relaxed); }
+						break;
+				}
+
+			shard.chars_scanned.fetch_add(chars, std::memory_order_relaxed);
+			shard.total_ns.fetch_add(ns, std::memory_order_relaxed);
+			shard.latency_buckets[_get_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+
+				// shard is shared only above shards count of threads, so lost update of max is acceptable there
+				if (heap_frames_size > shard.max_heap_frames_size.load(std::memory_order_relaxed)) {
+					shard.max_heap_frames_size.store(heap_frames_size, std::memory_order_relaxed);
+				}
+		}
+
+		/// @brief returns statistics summed from all threads since regex was compiled (not changed by reset)
+		regex_stats_snapshot get_total_snapshot() const {
+			regex_stats_snapshot snapshot;
+			snapshot.pattern = _pattern;
+			snapshot.options = _options;
+				for (const _shard& shard : _shards) {
+					snapshot.calls		   += shard.calls.load(std::memory_order_relaxed);
+					snapshot.matches	   += shard.matches.load(std::memory_order_relaxed);
+					snapshot.misses		   += shard.misses.load(std::memory_order_relaxed);
+					snapshot.limit_errors  += shard.limit_errors.load(std::memory_order_relaxed);
+					snapshot.other_errors  += shard.other_errors.load(std::memory_order_relaxed);
+					snapshot.chars_scanned += shard.chars_scanned.load(std::memory_order_relaxed);
+					snapshot.total_ns	   += shard.total_ns.load(std::memory_order_relaxed);
+					snapshot.max_heap_frames_size =
+					  std::max(snapshot.max_heap_frames_size, shard.max_heap_frames_size.load(std::memory_order_relaxed));
+						for (size_t i = 0; i != regex_stats_buckets_count; ++i) {
+							snapshot.latency_buckets[i] += shard.latency_buckets[i].load(std::memory_order_relaxed);
+						}
+				}
+			return snapshot;
+		}
+
+		/// @brief returns statistics summed from all threads since last reset
+		regex_stats_snapshot get_snapshot() const {
+			regex_stats_snapshot snapshot = get_total_snapshot();
+
+			const std::lock_guard<std::mutex> lock(_reset_mutex);
+			snapshot.calls		   -= _reset_base.calls;
+			snapshot.matches	   -= _reset_base.matches;
+			snapshot.misses		   -= _reset_base.misses;
+			snapshot.limit_errors  -= _reset_base.limit_errors;
+			snapshot.other_errors  -= _reset_base.other_errors;
+			snapshot.chars_scanned -= _reset_base.chars_scanned;
+			snapshot.total_ns	   -= _reset_base.total_ns;
+				for (size_t i = 0; i != regex_stats_buckets_count; ++i) {
+					snapshot.latency_buckets[i] -= _reset_base.latency_buckets[i];
+				}
+			return snapshot;
+		}
+
+		/// @brief sets counters of snapshots to zero (totals keep growing) and max heap frames size to zero
+		void reset() noexcept {
+			const std::lock_guard<std::mutex> lock(_reset_mutex);
+			_reset_base = get_total_snapshot();
+				for (_shard& shard : _shards) { shard.max_heap_frames_size.store(0, std::memory_order_relaxed); }
+		}
+	};
+
+	/**
+	 * @brief Registry of statistics of all regexes (regexes register themselves when they are compiled). Statistics of
+	 * destroyed regexes are kept summed by pattern and compile options, so totals never decrease
+	 * @ingroup pcre2cpp
+	 */
+	class regex_stats_registry {
+	private:
+		std::mutex _mutex;
+		/// @brief statistics of regexes (entry which isn't shared with any regex belongs to destroyed regex)
+		std::vector<std::shared_ptr<regex_stats>> _stats;
+		/// @brief totals of destroyed regexes sorted by pattern and compile options
+		std::vector<regex_stats_snapshot> _retired;
+		/// @brief count of entries after which statistics of destroyed regexes are folded into retired totals
+		size_t _cleanup_size = 64;
+
+		regex_stats_registry() noexcept = default;
+
+		/// @brief returns true if statistics belong to destroyed regex (registry is its only owner)
+		static bool _is_retired(const std::shared_ptr<regex_stats>& stats) noexcept { return stats.use_count() == 1; }
+
+		/// @brief folds statistics of destroyed regexes into retired totals (mutex has to be locked)
+		void _retire() {
+				for (const std::shared_ptr<regex_stats>& stats : _stats) {
+						if (!_is_retired(stats)) { continue; }
+
+					const regex_stats_snapshot totals = stats->get_total_snapshot();
+					const auto it = std::lower_bound(_retired.begin(), _retired.end(), totals,
+					  [](const regex_stats_snapshot& a, const regex_stats_snapshot& b) { return a.is_before(b); });
+						if (it != _retired.end() && it->is_same_regex(totals)) { it->merge(totals); }
+						else { _retired.insert(it, totals); }
+				}
+			_stats.erase(std::remove_if(_stats.begin(), _stats.end(), _is_retired), _stats.end());
+		}
+
+	public:
+		/// @brief returns global registry
+		static regex_stats_registry& get_instance() noexcept {
+			static regex_stats_registry registry;
+			return registry;
+		}
+
+		/// @brief adds statistics of regex
+		void add(const std::shared_ptr<regex_stats>& stats) {
+			const std::lock_guard<std::mutex> lock(_mutex);
+				if (_stats.size() >= _cleanup_size) {
+					_retire();
+					_cleanup_size = std::max<size_t>(_stats.size() * 2, 64);
+				}
+			_stats.push_back(stats);
+		}
+
+		/// @brief returns snapshots of all living regexes (counted since their last reset)
+		std::vector<regex_stats_snapshot> get_snapshots() {
+			std::vector<std::shared_ptr<regex_stats>> stats;
+			{
+				const std::lock_guard<std::mutex> lock(_mutex);
+				stats.reserve(_stats.size());
+					for (const std::shared_ptr<regex_stats>& entry : _stats) {
+							if (!_is_retired(entry)) { stats.push_back(entry); }
+					}
+			}
+
+			std::vector<regex_stats_snapshot> snapshots;
+			snapshots.reserve(stats.size());
+				for (const std::shared_ptr<regex_stats>& ptr : stats) { snapshots.push_back(ptr->get_snapshot()); }
+			return snapshots;
+		}
+
+		/**
+		 * @brief returns totals of all regexes since they were compiled (destroyed ones too, not changed by reset) summed by
+		 * pattern and compile options and sorted by them
+		 */
+		std::vector<regex_stats_snapshot> get_totals() {
+			const std::lock_guard<std::mutex> lock(_mutex);
+			_retire();
+
+			std::vector<regex_stats_snapshot> totals = _retired;
+				for (const std::shared_ptr<regex_stats>& stats : _stats) {
+					const regex_stats_snapshot snapshot = stats->get_total_snapshot();
+					const auto it = std::lower_bound(totals.begin(), totals.end(), snapshot,
+					  [](const regex_stats_snapshot& a, const regex_stats_snapshot& b) { return a.is_before(b); });
+						if (it != totals.end() && it->is_same_regex(snapshot)) { it->merge(snapshot); }
+						else { totals.insert(it, snapshot); }
+				}
+			return totals;
+		}
+	};
+
+	/**
+	 * @brief returns statistics of all regexes in Prometheus text exposition format (one series per pattern and compile
+	 * options, so separately compiled regexes are summed and destroyed regexes stay counted, latency as histogram in
+	 * seconds). Counters are totals since regexes were compiled, so they aren't changed by regex::reset_stats
+	 * @ingroup pcre2cpp
+	 */
+	inline std::string get_prometheus_stats() {
+		const std::vector<regex_stats_snapshot> snapshots = regex_stats_registry::get_instance().get_totals();
+
+		const auto escape = [](const std::string_view text) {
+			std::string escaped;
+			escaped.reserve(text.size());
+				for (const char c : text) {
+						if (c == '\\' || c == '"') { escaped += '\\'; }
+						if (c == '\n') { escaped += "\\n"; }
+						else { escaped += c; }
+				}
+			return escaped;
+		};
+
+		// series with the same labels would make Prometheus reject whole scrape
+		const auto labels = [&](const regex_stats_snapshot& snapshot) {
+			return fmt::format("pattern=\"{}\",options=\"{:#x}\"", escape(snapshot.pattern), snapshot.options);
+		};
+
+		std::string out;
+		const auto counter = [&](const std::string_view name, const std::string_view help,
+							   uint64_t regex_stats_snapshot::* value) {
+			out += fmt::format("# HELP {} {}\n# TYPE {} counter\n", name, help, name);
+				for (const regex_stats_snapshot& snapshot : snapshots) {
+					out += fmt::format("{}{{{}}} {}\n", name, labels(snapshot), snapshot.*value);
+				}
+		};
+
+		counter("pcre2cpp_match_calls_total", "Count of match calls.", &regex_stats_snapshot::calls);
+		counter("pcre2cpp_matches_total", "Count of match calls which found match.", &regex_stats_snapshot::matches);
+		counter("pcre2cpp_misses_total", "Count of match calls which found no match.", &regex_stats_snapshot::misses);
+		counter("pcre2cpp_limit_errors_total", "Count of match calls stopped by match, depth or heap limit.",
+		  &regex_stats_snapshot::limit_errors);
+		counter("pcre2cpp_other_errors_total", "Count of match calls which ended with other error.",
+		  &regex_stats_snapshot::other_errors);
+		counter("pcre2cpp_chars_scanned_total", "Count of searched subject characters.",
+		  &regex_stats_snapshot::chars_scanned);
+
+		out += "# HELP pcre2cpp_heap_frames_max_bytes Maximal size of pcre2 heap frames after match.\n"
+			   "# TYPE pcre2cpp_heap_frames_max_bytes gauge\n";
+			for (const regex_stats_snapshot& snapshot : snapshots) {
+				out += fmt::format("pcre2cpp_heap_frames_max_bytes{{{}}} {}\n", labels(snapshot), snapshot.max_heap_frames_size);
+			}
+
+		out += "# HELP pcre2cpp_match_duration_seconds Duration of match calls.\n"
+			   "# TYPE pcre2cpp_match_duration_seconds histogram\n";
+			for (const regex_stats_snapshot& snapshot : snapshots) {
+				const std::string series = labels(snapshot);
+				uint64_t cumulative		 = 0;
+					for (size_t i = 0; i + 1 < regex_stats_buckets_count; ++i) {
+						cumulative += snapshot.latency_buckets[i];
+						out		   += fmt::format("pcre2cpp_match_duration_seconds_bucket{{{},le=\"{:g}\"}} {}\n", series,
+							   static_cast<double>(uint64_t(1) << i) * 1e-9, cumulative);
+					}
+				out += fmt::format("pcre2cpp_match_duration_seconds_bucket{{{},le=\"+Inf\"}} {}\n", series, snapshot.calls);
+				out += fmt::format("pcre2cpp_match_duration_seconds_sum{{{}}} {:g}\n", series,
+				  static_cast<double>(snapshot.total_ns) * 1e-9);
+				out += fmt::format("pcre2cpp_match_duration_seconds_count{{{}}} {}\n", series, snapshot.calls);
+			}
+		return out;
+	}
+
+	/**
+	 * @brief returns statistics of all living regexes (counted since their last reset)
+	 * @ingroup pcre2cpp
+	 */
+	inline std::vector<regex_stats_snapshot> get_all_regex_stats() {
+		return regex_stats_registry::get_instance().get_snapshots();
+	}
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -0,0 +1,204 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_SLOW_MATCH_LOG_HPP_
+	#define _PCRE2CPP_SLOW_MATCH_LOG_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#elif !_PCRE2CPP_HAS_SLOW_MATCH_LOG
+_PCRE2CPP_ERROR("This is only available when PCRE2CPP_ENABLE_SLOW_MATCH_LOG is defined!");
+	#else
+
+		#include <pcre2cpp/match/match_error_codes.hpp>
+		#include <pcre2cpp/types.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Slow match recorded in slow match log
+	 * @ingroup pcre2cpp
+	 */
+	struct slow_match_entry {
+		/// @brief number of entry (counted from creation of log)
+		uint64_t sequence		= 0;
+		/// @brief pattern of regex (UTF-8, truncated to slow_match_log::max_pattern_size bytes)
+		std::string pattern;
+		/// @brief raw pcre2 match options bits
+		uint32_t options		= 0;
+		/// @brief result of pcre2 match
+		match_error_codes code	= match_error_codes::None;
+		/// @brief length of subject (in code units)
+		size_t subject_length	= 0;
+		/// @brief beginning of subject from search offset (UTF-8, truncated to slow_match_log::max_subject_size bytes)
+		std::string subject_prefix;
+		/// @brief duration of match
+		std::chrono::nanoseconds duration { 0 };
+	};
+
+	/**
+	 * @brief Bounded log of slow matches (and matches stopped by limits). Writers claim slots with one atomic increment
+	 * and publish them with sequence numbers (seqlock), so recording never locks and never allocates, and readers skip
+	 * slots which are overwritten during reading. When log is full the oldest entries are overwritten
+	 * @ingroup pcre2cpp
+	 */
+	class slow_match_log {
+	public:
+		/// @brief count of kept entries
+		static constexpr size_t capacity		  = 256;
+		/// @brief max count of stored pattern bytes
+		static constexpr size_t max_pattern_size = 128;
+		/// @brief max count of stored subject bytes
+		static constexpr size_t max_subject_size = 64;
+
+	private:
+		/// @brief entry data copied into slot words
+		struct _payload {
+			uint64_t subject_length;
+			int64_t duration_ns;
+			uint32_t options;
+			int32_t code;
+			uint16_t pattern_size;
+			uint16_t subject_size;
+			char pattern[max_pattern_size];
+			char subject[max_subject_size];
+		};
+
+		static constexpr size_t _words_count = (sizeof(_payload) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+		/// @brief slot of ring, sequence is odd while it is written and 2 * (index + 1) when entry index is written
+		struct alignas(64) _slot {
+			std::atomic<uint64_t> sequence = 0;
+			std::array<std::atomic<uint64_t>, _words_count> words = {};
+		};
+
+		std::array<_slot, capacity> _slots;
+		/// @brief index of next entry
+		std::atomic<uint64_t> _head			= 0;
+		/// @brief index of first entry returned by readers (set by clear)
+		std::atomic<uint64_t> _first		= 0;
+		/// @brief default threshold in nanoseconds (0 means that only limit errors are recorded)
+		std::atomic<int64_t> _threshold_ns	= 0;
+		/// @brief true if recording is enabled
+		std::atomic<bool> _enabled			= false;
+
+		slow_match_log() noexcept = default;
+
+	public:
+		/// @brief returns global log used by regexes
+		static slow_match_log& get_instance() noexcept {
+			static slow_match_log log;
+			return log;
+		}
+
+		/// @brief enables recording of matches longer than threshold (regexes can override it) and matches stopped by limits
+		void enable(const std::chrono::nanoseconds threshold) noexcept {
+			_threshold_ns.store(threshold.count(), std::memory_order_relaxed);
+			_enabled.store(true, std::memory_order_relaxed);
+		}
+
+		/// @brief disables recording
+		void disable() noexcept { _enabled.store(false, std::memory_order_relaxed); }
+
+		/// @brief returns true if recording is enabled
+		bool is_enabled() const noexcept { return _enabled.load(std::memory_order_relaxed); }
+
+		/// @brief returns default threshold
+		std::chrono::nanoseconds get_threshold() const noexcept {
+			return std::chrono::nanoseconds(_threshold_ns.load(std::memory_order_relaxed));
+		}
+
+		/**
+		 * @brief records slow match (pattern and subject prefix are truncated)
+		 * @param pattern pattern of regex (UTF-8)
+		 * @param options raw pcre2 match options bits
+		 * @param code result of pcre2 match
+		 * @param subject_length length of subject
+		 * @param subject_prefix beginning of subject (UTF-8)
+		 * @param duration duration of match
+		 */
+		void record(const std::string_view pattern, const uint32_t options, const int code, const size_t subject_length,
+		  const std::string_view subject_prefix, const std::chrono::nanoseconds duration) noexcept {
+			_payload payload {};
+			payload.subject_length = subject_length;
+			payload.duration_ns	   = duration.count();
+			payload.options		   = options;
+			payload.code		   = code;
+			payload.pattern_size   = static_cast<uint16_t>(std::min(pattern.size(), max_pattern_size));
+			payload.subject_size   = static_cast<uint16_t>(std::min(subject_prefix.size(), max_subject_size));
+			std::memcpy(payload.pattern, pattern.data(), payload.pattern_size);
+			std::memcpy(payload.subject, subject_prefix.data(), payload.subject_size);
+
+			uint64_t words[_words_count] = {};
+			std::memcpy(words, &payload, sizeof(_payload));
+
+			const uint64_t index = _head.fetch_add(1, std::memory_order_relaxed);
+			_slot& slot			 = _slots[index % capacity];
+			slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+				for (size_t i = 0; i != _words_count; ++i) { slot.words[i].store(words[i], std::memory_order_relaxed); }
+			slot.sequence.store(index * 2 + 2, std::memory_order_release);
+		}
+
+		/// @brief returns recorded entries from the oldest (entries which are written or overwritten now are skipped)
+		std::vector<slow_match_entry> get_entries() const {
+			const uint64_t head	 = _head.load(std::memory_order_acquire);
+			const uint64_t first = std::max(_first.load(std::memory_order_relaxed), head > capacity ? head - capacity : 0);
+
+			std::vector<slow_match_entry> entries;
+			entries.reserve(static_cast<size_t>(head - first));
+				for (uint64_t index = first; index < head; ++index) {
+					const _slot& slot		= _slots[index % capacity];
+					const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+						if (sequence != index * 2 + 2) { continue; }
+
+					uint64_t words[_words_count];
+						for (size_t i = 0; i != _words_count; ++i) { words[i] = slot.words[i].load(std::memory_order_relaxed); }
+					std::atomic_thread_fence(std::memory_order_acquire);
+						if (slot.sequence.load(std::memory_order_relaxed) != sequence) { continue; }
+
+					_payload payload;
+					std::memcpy(&payload, words, sizeof(_payload));
+					entries.push_back(slow_match_entry {
+						.sequence		= index,
+						.pattern		= std::string(payload.pattern, std::min<size_t>(payload.pattern_size, max_pattern_size)),
+						.options		= payload.options,
+						.code			= static_cast<match_error_codes>(payload.code),
+						.subject_length = static_cast<size_t>(payload.subject_length),
+						.subject_prefix = std::string(payload.subject, std::min<size_t>(payload.subject_size, max_subject_size)),
+						.duration		= std::chrono::nanoseconds(payload.duration_ns),
+					});
+				}
+			return entries;
+		}
+
+		/// @brief returns recorded entries as text (one line per entry)
+		std::string dump() const {
+			std::string out;
+				for (const slow_match_entry& entry : get_entries()) {
+					out += fmt::format("#{} {} ns code={} options=0x{:x} length={} pattern=\"{}\" subject=\"{}\"\n",
+					  entry.sequence, entry.duration.count(), static_cast<int>(entry.code), entry.options,
+					  entry.subject_length, entry.pattern, entry.subject_prefix);
+				}
+			return out;
+		}
+
+		/// @brief forgets recorded entries (entries recorded at the same time can be kept)
+		void clear() noexcept { _first.store(_head.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+	};
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -0,0 +1,213 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_STREAM_MATCHER_HPP_
+	#define _PCRE2CPP_STREAM_MATCHER_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/match/match_error_codes.hpp>
+		#include <pcre2cpp/match/match_options.hpp>
+		#include <pcre2cpp/regex/match_index.hpp>
+		#include <pcre2cpp/regex/regex.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+	/**
+	 * @brief Matches subject delivered in parts (e.g. read from file) and reports the same matches as match_all over whole
+	 * subject. Matches which cross boundary of parts are found with partial matching, so only text from beginning of
+	 * unfinished match (and pattern's max lookbehind before it) is kept between parts. Anchored patterns (e.g. starting
+	 * with \\G) stop matching after first failed search like match_all does. Match errors (e.g. match limit) are
+	 * returned by feed and finish, matcher ignores next parts after error until reset
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_stream_matcher {
+	private:
+		using _pcre2_data_t		= utils::pcre2_data<utf>;
+		using _string_type		= typename _pcre2_data_t::string_type;
+		using _string_view_type = typename _pcre2_data_t::string_view_type;
+		using _regex_type		= basic_regex<utf>;
+
+		/// @brief matched regex
+		_regex_type _regex;
+		/// @brief match options used for every match
+		match_options _opts;
+		/// @brief count of code units kept before scan offset (max lookbehind in characters, at least 1 for \b and
+		/// multiline ^, times max size of character in UTF mode)
+		size_t _keep_before;
+		/// @brief true if pattern or match options are anchored, so nothing matches after first failed search
+		bool _anchored;
+		/// @brief true if anchored search failed, so no next match can be found
+		bool _finished				= false;
+		/// @brief match error which stopped matching
+		match_error_codes _error	= match_error_codes::None;
+		/// @brief not finished part of subject
+		_string_type _window;
+		/// @brief offset of window from the beginning of subject
+		size_t _window_offset = 0;
+		/// @brief offset in window from which next match starts
+		size_t _scan		  = 0;
+
+		/// @brief returns match options for current window (its beginning isn't beginning of subject after first part)
+		_PCRE2CPP_CONSTEXPR17 match_options _window_opts() const noexcept {
+			return _window_offset != 0 ? _opts | match_options_bits::NotBOL : _opts;
+		}
+
+		/// @brief removes text which can't be part of any next match
+		_PCRE2CPP_CONSTEXPR20 void _trim() noexcept {
+			const size_t keep = std::min(_scan, _window.size());
+				if (keep <= _keep_before) { return; }
+
+			size_t removed = keep - _keep_before;
+				// window can't start in the middle of character
+				if (_regex.is_utf()) {
+					while (removed != 0 && _pcre2_data_t::is_char_continuation(_window[removed])) { --removed; }
+				}
+			_window.erase(0, removed);
+			_window_offset += removed;
+			_scan		   -= removed;
+		}
+
+	public:
+		/**
+		 * @brief stream matcher of regex
+		 * @param regex matched regex
+		 * @param opts match options used for every match (partial options are added by matcher)
+		 */
+		_PCRE2CPP_CONSTEXPR20 explicit basic_stream_matcher(const _regex_type& regex,
+		  const match_options opts = match_options_bits::None) noexcept
+			: _regex(regex), _opts(opts),
+			  _keep_before(std::max<size_t>(regex.get_max_lookbehind(), 1) * (regex.is_utf() ? _pcre2_data_t::max_char_size : 1)),
+			  _anchored(regex.is_anchored() || (static_cast<uint32_t>(opts) & PCRE2_ANCHORED) != 0) {}
+
+		/// @brief clears matcher state (and error) so next part is beginning of new subject
+		_PCRE2CPP_CONSTEXPR20 void reset() noexcept {
+			_window.clear();
+			_window_offset = 0;
+			_scan		   = 0;
+			_finished	   = false;
+			_error		   = match_error_codes::None;
+		}
+
+		/**
+		 * @brief matches next part of subject and reports every match which can't change after next parts
+		 * @tparam Callable callable which takes const match_span& (offset from the beginning of whole subject)
+		 * @param part next part of subject
+		 * @param on_match callable called for every finished match
+		 * @return match_error_codes::None or match error (e.g. match_error_codes::MatchLimit) of this or previous part
+		 */
+		template<class Callable>
+		_PCRE2CPP_CONSTEXPR20 match_error_codes feed(const _string_view_type part, Callable&& on_match) noexcept {
+				if (_finished || _error != match_error_codes::None) { return _error; }
+			_window.append(part.data(), part.size());
+
+			// last character of part can be unfinished in UTF mode (pcre2 rejects it), so it is matched with next part
+			_string_view_type window = _window;
+				if (_regex.is_utf() && _pcre2_data_t::max_char_size != 1 && !window.empty()) {
+					size_t end = window.size() - 1;
+						while (end != 0 && _pcre2_data_t::is_char_continuation(window[end])) { --end; }
+					window = window.substr(0, std::max(end, _scan));
+				}
+
+			const match_options opts = _window_opts();
+			size_t match_start;
+			size_t match_end;
+				while (true) {
+					const match_error_codes code = _regex.find_partial(window, match_start, match_end, _scan, opts);
+						if (code == match_error_codes::None) {
+							on_match(match_span { _window_offset + match_start, match_end - match_start });
+							_scan = _regex.get_next_offset(window, match_start, match_end);
+							continue;
+						}
+
+						// match can start at partial match, nothing before it can match
+						if (code == match_error_codes::Partial) { _scan = match_start; }
+						else if (code == match_error_codes::NoMatch && _anchored) {
+							_finished = true;
+							_window.clear();
+						}
+						else if (code == match_error_codes::NoMatch) { _scan = std::max(_scan, window.size()); }
+						else { _error = code; }
+					break;
+				}
+
+				if (!_finished) { _trim(); }
+			return _error;
+		}
+
+		/**
+		 * @brief matches rest of subject after last part and resets matcher
+		 * @tparam Callable callable which takes const match_span& (offset from the beginning of whole subject)
+		 * @param on_match callable called for every remaining match
+		 * @return match_error_codes::None or match error (e.g. match_error_codes::MatchLimit) of any part
+		 */
+		template<class Callable>
+		_PCRE2CPP_CONSTEXPR20 match_error_codes finish(Callable&& on_match) noexcept {
+				if (_finished || _error != match_error_codes::None) {
+					const match_error_codes error = _error;
+					reset();
+					return error;
+				}
+
+			const match_options opts = _window_opts();
+			size_t match_start;
+			size_t match_end;
+			match_error_codes code;
+				while ((code = _regex.try_find(_window, match_start, match_end, _scan, opts)) == match_error_codes::None) {
+					on_match(match_span { _window_offset + match_start, match_end - match_start });
+					_scan = _regex.get_next_offset(_window, match_start, match_end);
+				}
+
+			reset();
+			return code == match_error_codes::NoMatch ? match_error_codes::None : code;
+		}
+
+		/// @brief returns count of characters kept between parts
+		_PCRE2CPP_CONSTEXPR17 size_t get_buffered_size() const noexcept { return _window.size(); }
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8stream_matcher = basic_stream_matcher<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16stream_matcher = basic_stream_matcher<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32stream_matcher = basic_stream_matcher<utf_type::UTF_32>;
+		#endif
+
+	using stream_matcher = basic_stream_matcher<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_stream_matcher<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_stream_matcher<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_stream_matcher<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
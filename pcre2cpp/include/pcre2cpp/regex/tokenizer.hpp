@@ -0,0 +1,561 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_TOKENIZER_HPP_
+	#define _PCRE2CPP_TOKENIZER_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/exceptions/exceptions.hpp>
+		#include <pcre2cpp/match/match_error_codes.hpp>
+		#include <pcre2cpp/match/match_options.hpp>
+		#include <pcre2cpp/regex/compile_options.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp {
+		#pragma region TOKEN_RULE
+
+	/**
+	 * @brief Token rule container
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	struct basic_token_rule {
+	private:
+		using _string_view_type = typename utils::pcre2_data<utf>::string_view_type;
+
+	public:
+		/// @brief user defined id of token
+		size_t id;
+		/// @brief pattern of token
+		_string_view_type pattern;
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8token_rule = basic_token_rule<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16token_rule = basic_token_rule<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32token_rule = basic_token_rule<utf_type::UTF_32>;
+		#endif
+
+	using token_rule = basic_token_rule<default_utf_type>;
+		#pragma endregion
+
+		#pragma region TOKEN
+
+	/**
+	 * @brief Token container
+	 * @ingroup pcre2cpp
+	 */
+	struct token {
+		/// @brief id of rule which matched token
+		size_t id;
+		/// @brief offset from the beginning of tokenized string
+		size_t offset;
+		/// @brief size of token
+		size_t size;
+	};
+
+		#pragma endregion
+
+	/**
+	 * @brief Token selection policy
+	 * @ingroup pcre2cpp
+	 */
+	enum class token_match_policy : uint8_t {
+		/// @brief first rule (in order of rules) which matches at position wins
+		Priority,
+		/// @brief rule with longest match of any of its top-level alternatives at position wins, on ties first rule wins
+		Longest
+	};
+
+	/**
+	 * @brief Tokenizer which combines all token rules into one anchored pattern dispatched with (*MARK)
+	 * @ingroup pcre2cpp
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class basic_tokenizer {
+	private:
+		using _pcre2_data_t		 = utils::pcre2_data<utf>;
+
+		using _code_type		 = typename _pcre2_data_t::code_type;
+		using _code_ptr			 = std::shared_ptr<_code_type>;
+		using _match_data_type	 = typename _pcre2_data_t::match_data_type;
+		using _match_data_ptr	 = std::shared_ptr<_match_data_type>;
+		using _match_ctx_type	 = typename _pcre2_data_t::match_ctx_type;
+		using _match_ctx_ptr	 = std::shared_ptr<_match_ctx_type>;
+		using _callout_block	 = typename _pcre2_data_t::callout_block_type;
+		using _string_type		 = typename _pcre2_data_t::string_type;
+		using _string_view_type	 = typename _pcre2_data_t::string_view_type;
+		using _string_char_type	 = typename _pcre2_data_t::string_char_type;
+		using _sptr_type		 = typename _pcre2_data_t::sptr_type;
+		using _uchar_type		 = typename _pcre2_data_t::uchar_type;
+		using _token_rule_type	 = basic_token_rule<utf>;
+		#if _PCRE2CPP_HAS_EXCEPTIONS
+		using _regex_exception = basic_regex_exception<utf>;
+		#endif
+
+		/// @brief value of rule index when no rule matched
+		static _PCRE2CPP_CONSTEXPR17 size_t _no_rule = std::numeric_limits<size_t>::max();
+
+		/// @brief longest match data filled by callout
+		struct _longest_match_data {
+			/// @brief end of longest match found so far
+			size_t end;
+			/// @brief index of rule with longest match
+			size_t rule;
+		};
+
+		/// @brief pointer to compiled combined pcre2 code
+		_code_ptr _code				  = nullptr;
+		/// @brief pointer to match data of combined pcre2 code
+		_match_data_ptr _match_data	  = nullptr;
+		/// @brief pointer to match context with callout (only for token_match_policy::Longest, it isn't changed after
+		/// construction, so copies can share it)
+		_match_ctx_ptr _match_ctx	  = nullptr;
+		/// @brief ids of rules in order of rules
+		std::vector<size_t> _ids	  = {};
+		/// @brief token selection policy
+		token_match_policy _policy	  = token_match_policy::Priority;
+
+		/// @brief appends ascii string to pattern
+		static _PCRE2CPP_CONSTEXPR20 void _append_ascii(_string_type& pattern, const std::string_view ascii) noexcept {
+				for (const char c : ascii) { pattern.push_back(static_cast<_string_char_type>(c)); }
+		}
+
+		/// @brief converts (*MARK) name to rule index
+		static _PCRE2CPP_CONSTEXPR17 size_t _mark_to_rule(_sptr_type mark) noexcept {
+				if (mark == nullptr) { return _no_rule; }
+
+			size_t rule = 0;
+				for (; *mark != 0; ++mark) { rule = rule * 10 + static_cast<size_t>(*mark - '0'); }
+			return rule;
+		}
+
+		/// @brief returns longest match data of match running in current thread (it isn't callout data, because match
+		/// context is shared by copies of tokenizer used concurrently)
+		static _longest_match_data*& _current_longest() noexcept {
+			static thread_local _longest_match_data* longest = nullptr;
+			return longest;
+		}
+
+		/// @brief callout called after each alternative of rule which matched, remembers the longest one
+		static int _longest_match_callout(_callout_block* block, [[maybe_unused]] void* data) noexcept {
+			_longest_match_data* longest = _current_longest();
+				if (block->current_position > longest->end) {
+					longest->end  = block->current_position;
+					longest->rule = _mark_to_rule(block->mark);
+				}
+			// force backtracking into next rule
+			return 0;
+		}
+
+		/**
+		 * @brief returns the lowest group number referenced by number in pattern (back reference, subroutine call or
+		 * condition), 0 for recursion of whole pattern and _no_rule when pattern doesn't reference groups by number
+		 */
+		static _PCRE2CPP_CONSTEXPR20 size_t _find_number_reference(const _string_view_type pattern) noexcept {
+			const auto is_char	   = [&](const size_t i, const char c) {
+				return i < pattern.size() && pattern[i] == static_cast<_string_char_type>(c);
+			};
+			const auto is_digit	   = [&](const size_t i) {
+				return i < pattern.size() && pattern[i] >= static_cast<_string_char_type>('0') &&
+					   pattern[i] <= static_cast<_string_char_type>('9');
+			};
+			const auto read_number = [&](size_t i) {
+				size_t number = 0;
+					for (; is_digit(i); ++i) { number = number * 10 + static_cast<size_t>(pattern[i] - '0'); }
+				return number;
+			};
+
+			size_t lowest = _no_rule;
+			bool in_class = false;
+				for (size_t i = 0; i < pattern.size(); ++i) {
+					size_t number_start = _no_rule;
+						if (is_char(i, '\\') && is_char(i + 1, 'Q')) {
+							// quoted text ends with \E
+								for (i += 2; i < pattern.size() && !(is_char(i, '\\') && is_char(i + 1, 'E')); ++i) {}
+							++i;
+							continue;
+						}
+						if (is_char(i, '\\')) {
+							// digits in class and \0 are octal characters, \g+1 and \g-1 are relative references
+								if (!in_class && is_digit(i + 1) && !is_char(i + 1, '0')) { number_start = i + 1; }
+								else if (!in_class && is_char(i + 1, 'g')) {
+									const bool is_braced = is_char(i + 2, '{') || is_char(i + 2, '<') || is_char(i + 2, '\'');
+									const size_t start	 = is_braced ? i + 3 : i + 2;
+									number_start		 = is_digit(start) ? start : _no_rule;
+								}
+							++i;
+						}
+						else if (in_class) {
+								if (is_char(i, '[') && is_char(i + 1, ':')) {
+									// posix class ends with :]
+										for (i += 2; i < pattern.size() && !(is_char(i, ':') && is_char(i + 1, ']')); ++i) {}
+									++i;
+								}
+								else if (is_char(i, ']')) { in_class = false; }
+						}
+						else if (is_char(i, '[')) {
+							in_class = true;
+								if (is_char(i + 1, '^')) { ++i; }
+								// ] right after start of class is literal
+								if (is_char(i + 1, ']')) { ++i; }
+						}
+						else if (is_char(i, '(') && is_char(i + 1, '?')) {
+								if (is_char(i + 2, '#')) {
+										while (i < pattern.size() && !is_char(i, ')')) { ++i; }
+								}
+								else if (is_char(i + 2, 'R') && is_char(i + 3, ')')) { lowest = 0; }
+								else if (is_digit(i + 2)) { number_start = i + 2; }
+								else if (is_char(i + 2, '(') && is_digit(i + 3)) { number_start = i + 3; }
+								else if (is_char(i + 2, '(') && is_char(i + 3, 'R') && is_digit(i + 4)) { number_start = i + 4; }
+						}
+
+						if (number_start != _no_rule) { lowest = std::min(lowest, read_number(number_start)); }
+				}
+			return lowest;
+		}
+
+		/**
+		 * @brief splits pattern into its top-level alternatives, each alternative starts with top-level option settings
+		 * of alternatives before it (e.g. "(?i)a|b" is split into "(?i)a" and "(?i)b")
+		 */
+		static _PCRE2CPP_CONSTEXPR20 std::vector<_string_type> _split_alternatives(const _string_view_type pattern,
+		  const compile_options opts) noexcept {
+			const auto is_char	 = [&](const size_t i, const char c) {
+				return i < pattern.size() && pattern[i] == static_cast<_string_char_type>(c);
+			};
+			// option letters (lowercase, J and U), unset and reset
+			const auto is_option = [&](const size_t i) {
+				return i < pattern.size() && ((pattern[i] >= static_cast<_string_char_type>('a') &&
+												pattern[i] <= static_cast<_string_char_type>('z')) ||
+											   is_char(i, 'J') || is_char(i, 'U') || is_char(i, '-') || is_char(i, '^'));
+			};
+
+			std::vector<_string_type> alternatives;
+			// top-level option settings found so far and the ones of alternatives before current one
+			_string_type options;
+			_string_type inherited;
+			// extended mode (comments after #) of every open group
+			std::vector<bool> extended = { (static_cast<uint32_t>(opts) & (PCRE2_EXTENDED | PCRE2_EXTENDED_MORE)) != 0 };
+			bool in_class			   = false;
+			size_t begin			   = 0;
+				for (size_t i = 0; i < pattern.size(); ++i) {
+						if (is_char(i, '\\') && is_char(i + 1, 'Q')) {
+							// quoted text ends with \E
+								for (i += 2; i < pattern.size() && !(is_char(i, '\\') && is_char(i + 1, 'E')); ++i) {}
+							++i;
+						}
+						else if (is_char(i, '\\')) { ++i; }
+						else if (in_class) {
+								if (is_char(i, '[') && is_char(i + 1, ':')) {
+									// posix class ends with :]
+										for (i += 2; i < pattern.size() && !(is_char(i, ':') && is_char(i + 1, ']')); ++i) {}
+									++i;
+								}
+								else if (is_char(i, ']')) { in_class = false; }
+						}
+						else if (is_char(i, '[')) {
+							in_class = true;
+								if (is_char(i + 1, '^')) { ++i; }
+								// ] right after start of class is literal
+								if (is_char(i + 1, ']')) { ++i; }
+						}
+						else if (extended.back() && is_char(i, '#')) {
+								while (i < pattern.size() && !is_char(i, '\n')) { ++i; }
+						}
+						else if (is_char(i, '(') && is_char(i + 1, '?') && is_char(i + 2, '#')) {
+								while (i < pattern.size() && !is_char(i, ')')) { ++i; }
+						}
+						else if (is_char(i, '(')) {
+							size_t end = i + 2;
+								while (is_char(i + 1, '?') && is_option(end)) { ++end; }
+							const bool is_setting = is_char(i + 1, '?') && (is_char(end, ')') || is_char(end, ':'));
+
+							bool is_extended	  = extended.back();
+								if (is_setting) {
+									bool unset = false;
+										for (size_t j = i + 2; j != end; ++j) {
+												if (is_char(j, '^')) { is_extended = false; }
+												else if (is_char(j, '-')) { unset = true; }
+												else if (is_char(j, 'x')) { is_extended = !unset; }
+										}
+								}
+
+								// setting without group changes rest of current group
+								if (is_setting && is_char(end, ')')) {
+									extended.back() = is_extended;
+										if (extended.size() == 1) { options.append(pattern.substr(i, end + 1 - i)); }
+									i = end;
+									continue;
+								}
+							extended.push_back(is_extended);
+						}
+						else if (is_char(i, ')')) {
+								if (extended.size() != 1) { extended.pop_back(); }
+						}
+						else if (is_char(i, '|') && extended.size() == 1) {
+							alternatives.push_back(inherited + _string_type(pattern.substr(begin, i - begin)));
+							inherited = options;
+							begin	  = i + 1;
+						}
+				}
+			alternatives.push_back(inherited + _string_type(pattern.substr(std::min(begin, pattern.size()))));
+			return alternatives;
+		}
+
+		/// @brief fails like basic_regex constructor with message when rules can't be combined
+		static void _fail_rules([[maybe_unused]] const std::string& message) _PCRE2CPP_NOEXCEPT {
+		#if !_PCRE2CPP_HAS_EXCEPTIONS
+			pcre2cpp_assert(false, "Failed to combine token rules: {}", message);
+		#else
+			throw _regex_exception(_string_type(message.begin(), message.end()));
+		#endif
+		}
+
+		/// @brief returns names of groups of compiled code
+		static _PCRE2CPP_CONSTEXPR20 std::vector<_string_type> _get_group_names(const _code_type* code) noexcept {
+			uint32_t name_count		 = 0;
+			_uchar_type* name_table	 = nullptr;
+			uint32_t name_entry_size = 0;
+			_pcre2_data_t::get_info(code, PCRE2_INFO_NAMECOUNT, &name_count);
+			_pcre2_data_t::get_info(code, PCRE2_INFO_NAMETABLE, &name_table);
+			_pcre2_data_t::get_info(code, PCRE2_INFO_NAMEENTRYSIZE, &name_entry_size);
+
+			// group number takes 2 code units in 8-bit library and 1 in 16-bit and 32-bit libraries
+			const size_t number_size = utf == utf_type::UTF_8 ? 2 : 1;
+			std::vector<_string_type> names;
+				for (size_t i = 0; i != name_count; ++i) {
+					const _uchar_type* entry = name_table + i * name_entry_size + number_size;
+					size_t size			   = 0;
+						while (size != name_entry_size - number_size && entry[size] != 0) { ++size; }
+					names.emplace_back(reinterpret_cast<const _string_char_type*>(entry), size);
+				}
+			return names;
+		}
+
+		/// @brief compiles pattern and returns pointer to code (fails like basic_regex constructor)
+		static _code_ptr _compile(const _string_view_type pattern, const compile_options opts) _PCRE2CPP_NOEXCEPT {
+			int error_code;
+			size_t error_offset;
+
+			_code_type* code = _pcre2_data_t::compile(reinterpret_cast<_sptr_type>(pattern.data()), pattern.size(), opts,
+			  &error_code, &error_offset, nullptr);
+
+		#if !_PCRE2CPP_HAS_EXCEPTIONS
+			pcre2cpp_assert(code != nullptr, "Failed to initialize code: {}",
+			  convert_any_utf_to_utf8<utf>(generate_error_message<utf>(error_code, error_offset)));
+		#else
+				if (code == nullptr) { throw _regex_exception(error_code, error_offset); }
+		#endif
+
+			return _code_ptr(code, _pcre2_data_t::code_free);
+		}
+
+	public:
+		/**
+		 * @brief tokenizer with rules (in priority order), compile options of all rules and token selection policy. Rules
+		 * are combined into one pattern, so groups are numbered across rules: rules can't reference groups by number
+		 * when rules before them have groups, can't recurse whole pattern with (?R) and can't repeat group names of
+		 * other rules (unless compile_options_bits::DupNames is set)
+		 */
+		_PCRE2CPP_CONSTEXPR20 explicit basic_tokenizer(const std::vector<_token_rule_type>& rules,
+		  const compile_options opts = compile_options_bits::None,
+		  const token_match_policy policy = token_match_policy::Priority) _PCRE2CPP_NOEXCEPT : _policy(policy) {
+			// Build Combined Pattern
+			_string_type pattern;
+			_ids.reserve(rules.size());
+			std::vector<_string_type> names;
+			uint32_t groups_count = 0;
+				for (size_t i = 0; i != rules.size(); ++i) {
+					// validate rule alone so it can't break out of its group
+					const _code_ptr rule_code = _compile(rules[i].pattern, opts);
+
+					const size_t reference = _find_number_reference(rules[i].pattern);
+						if (reference == 0 || (reference != _no_rule && groups_count != 0)) {
+							_fail_rules(fmt::format("rule {} references groups by number, which are shifted by other rules", i));
+						}
+						for (_string_type& name : _get_group_names(rule_code.get())) {
+								if ((static_cast<uint32_t>(opts) & PCRE2_DUPNAMES) == 0 &&
+									std::find(names.begin(), names.end(), name) != names.end()) {
+									_fail_rules(fmt::format("rule {} repeats group name of other rule", i));
+								}
+							names.push_back(std::move(name));
+						}
+
+					uint32_t rule_groups = 0;
+					_pcre2_data_t::get_info(rule_code.get(), PCRE2_INFO_CAPTURECOUNT, &rule_groups);
+					groups_count += rule_groups;
+
+						if (i != 0) { _append_ascii(pattern, "|"); }
+					_append_ascii(pattern, "(?:");
+						if (_policy == token_match_policy::Longest) {
+							// every alternative is atomic, so callout sees end of each alternative once (backtracking
+							// through all paths of rule could take exponential time)
+							const std::vector<_string_type> alternatives = _split_alternatives(rules[i].pattern, opts);
+								for (size_t j = 0; j != alternatives.size(); ++j) {
+										if (j != 0) { _append_ascii(pattern, "|"); }
+									_append_ascii(pattern, "(?>");
+									pattern.append(alternatives[j]);
+									_append_ascii(pattern, ")");
+								}
+						}
+						else { pattern.append(rules[i].pattern); }
+					_append_ascii(pattern, ")(*MARK:");
+					_append_ascii(pattern, std::to_string(i));
+					_append_ascii(pattern, ")");
+						if (_policy == token_match_policy::Longest) { _append_ascii(pattern, "(?C1)(*FAIL)"); }
+
+					_ids.push_back(rules[i].id);
+				}
+				if (rules.empty()) { _append_ascii(pattern, "(*FAIL)"); }
+
+			// Compile Code
+			compile_options combined_opts = opts | compile_options_bits::Anchored;
+				if (_policy == token_match_policy::Longest) {
+					// start optimizations could skip callouts of rules
+					combined_opts = combined_opts | compile_options_bits::NoStartOptimize;
+				}
+			_code = _compile(pattern, combined_opts);
+
+			// Create Match Data
+			_match_data_type* match_data = _pcre2_data_t::match_data_from_pattern(_code.get(), nullptr);
+			_match_data					 = _match_data_ptr(match_data, _pcre2_data_t::match_data_free);
+
+				if (_policy == token_match_policy::Longest) {
+					_match_ctx_type* match_ctx = _pcre2_data_t::match_ctx_create(nullptr);
+					_match_ctx				   = _match_ctx_ptr(match_ctx, _pcre2_data_t::match_ctx_free);
+					_pcre2_data_t::set_callout(_match_ctx.get(), &_longest_match_callout, nullptr);
+				}
+		}
+
+		/// @brief default copy constructor
+		_PCRE2CPP_CONSTEXPR17 basic_tokenizer(const basic_tokenizer& other) noexcept			= default;
+		/// @brief default move constructor
+		_PCRE2CPP_CONSTEXPR17 basic_tokenizer(basic_tokenizer&& other) noexcept					= default;
+
+		/// @brief default destructor
+		_PCRE2CPP_CONSTEXPR20 ~basic_tokenizer() noexcept										= default;
+
+		/// @brief default copy assign operator
+		_PCRE2CPP_CONSTEXPR17 basic_tokenizer& operator=(const basic_tokenizer& other) noexcept = default;
+		/// @brief default move assign operator
+		_PCRE2CPP_CONSTEXPR17 basic_tokenizer& operator=(basic_tokenizer&& other) noexcept		= default;
+
+		/// @brief returns token selection policy
+		_PCRE2CPP_CONSTEXPR17 token_match_policy get_policy() const noexcept { return _policy; }
+
+		/// @brief returns count of rules
+		_PCRE2CPP_CONSTEXPR17 size_t get_rules_count() const noexcept { return _ids.size(); }
+
+		/**
+		 * @brief finds non-empty token which starts exactly at offset
+		 * @param text tokenized text
+		 * @param offset offset of token
+		 * @param result token (stored only when token was found)
+		 * @param opts match options
+		 * @return match_error_codes::None when token was found, match_error_codes::NoMatch when no rule matches at offset
+		 * or other error code of pcre2 (e.g. match_error_codes::MatchLimit), then token isn't reported
+		 */
+		_PCRE2CPP_CONSTEXPR17 match_error_codes find_token(const _string_view_type text, const size_t offset, token& result,
+		  const match_options opts = match_options_bits::None) const noexcept {
+				if (_policy == token_match_policy::Longest) {
+					_longest_match_data longest = { offset, _no_rule };
+					_current_longest()			= &longest;
+					const int match_code = _pcre2_data_t::match(_code.get(), reinterpret_cast<_sptr_type>(text.data()),
+					  text.size(), offset, opts, _match_data.get(), _match_ctx.get());
+					_current_longest() = nullptr;
+
+						// every alternative ends with (*FAIL), so limit error is the only way to stop before all were tried
+						if (match_code != static_cast<int>(match_error_codes::NoMatch)) {
+							return static_cast<match_error_codes>(match_code);
+						}
+						if (longest.rule == _no_rule) { return match_error_codes::NoMatch; }
+
+					result = token { _ids[longest.rule], offset, longest.end - offset };
+					return match_error_codes::None;
+				}
+
+			const int match_code = _pcre2_data_t::match(_code.get(), reinterpret_cast<_sptr_type>(text.data()), text.size(),
+			  offset, opts | match_options_bits::NotEmptyAtStart, _match_data.get(), nullptr);
+				if (match_code < 0) { return static_cast<match_error_codes>(match_code); }
+
+			const size_t* offsetVector = _pcre2_data_t::get_ovector_ptr(_match_data.get());
+			const size_t rule		   = _mark_to_rule(_pcre2_data_t::get_mark(_match_data.get()));
+
+				if (rule == _no_rule) { return match_error_codes::NoMatch; }
+
+			result = token { _ids[rule], offsetVector[0], offsetVector[1] - offsetVector[0] };
+			return match_error_codes::None;
+		}
+
+		/// @brief returns true if non-empty token starts exactly at offset and result is stored in result variable (errors
+		/// are reported by find_token)
+		_PCRE2CPP_CONSTEXPR17 bool next_token(const _string_view_type text, const size_t offset, token& result,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			return find_token(text, offset, result, opts) == match_error_codes::None;
+		}
+
+		/// @brief tokenizes text from offset in single forward pass, returns true if whole text was tokenized (find_token at
+		/// end of last token reports why tokenizing stopped)
+		_PCRE2CPP_CONSTEXPR20 bool tokenize(const _string_view_type text, std::vector<token>& tokens, size_t offset = 0,
+		  const match_options opts = match_options_bits::None) const noexcept {
+			token result {};
+				while (offset < text.size() && next_token(text, offset, result, opts)) {
+					tokens.push_back(result);
+					offset = result.offset + result.size;
+				}
+
+			return offset >= text.size();
+		}
+	};
+
+		#if _PCRE2CPP_HAS_UTF8
+	using u8tokenizer = basic_tokenizer<utf_type::UTF_8>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF16
+	using u16tokenizer = basic_tokenizer<utf_type::UTF_16>;
+		#endif
+		#if _PCRE2CPP_HAS_UTF32
+	using u32tokenizer = basic_tokenizer<utf_type::UTF_32>;
+		#endif
+
+	using tokenizer = basic_tokenizer<default_utf_type>;
+
+		#if _PCRE2CPP_EXTERN_TEMPLATES
+			#if _PCRE2CPP_HAS_UTF8
+	extern template class basic_tokenizer<utf_type::UTF_8>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF16
+	extern template class basic_tokenizer<utf_type::UTF_16>;
+			#endif
+			#if _PCRE2CPP_HAS_UTF32
+	extern template class basic_tokenizer<utf_type::UTF_32>;
+			#endif
+		#endif
+} // namespace pcre2cpp
+	#endif
+#endif
@@ -41,13 +41,43 @@ namespace pcre2cpp {
 	class basic_match_result_exception;
 		#endif
 
-	template<utf_type utf>
+	template<utf_type utf, class Allocator = std::allocator<typename utils::pcre2_data<utf>::string_char_type> >
 	struct basic_match_value;
 	struct sub_match_value;
-	template<utf_type utf>
+	template<utf_type utf, class Allocator = std::allocator<typename utils::pcre2_data<utf>::string_char_type> >
 	class basic_match_result;
 	template<utf_type utf>
+	class basic_match_view;
+	template<utf_type utf>
+	class basic_match_batch;
+	template<utf_type utf>
+	class basic_column;
+	template<utf_type utf>
+	class basic_column_batch;
+	template<utf_type utf>
+	class basic_compile_context;
+	struct memory_functions;
+	template<class CharT, class Class, class Member>
+	struct extraction_field;
+	template<class T>
+	struct extraction_traits;
+	template<utf_type utf>
 	class basic_regex;
+	class byte_view;
+	class byte_match_view;
+	class binary_regex;
+	struct match_span;
+	template<utf_type utf>
+	class basic_match_index;
+	template<utf_type utf>
+	class basic_stream_matcher;
+	enum class scan_backend : uint8_t;
+	class file_scanner;
+	template<utf_type utf>
+	struct basic_token_rule;
+	struct token;
+	template<utf_type utf>
+	class basic_tokenizer;
 } // namespace pcre2cpp
 	#endif
 #endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_BYTE_RANGE_HPP_
+	#define _PCRE2CPP_BYTE_RANGE_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/types.hpp>
+
+namespace pcre2cpp::utils {
+	/// @brief true if type is one byte type which can be matched as binary data
+	template<class T>
+	static _PCRE2CPP_CONSTEXPR17 bool is_byte_v =
+	  std::is_same_v<T, std::byte> || std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+	  std::is_same_v<T, unsigned char>;
+
+	/// @brief true if type is contiguous range (with std::data and std::size) of bytes
+	template<class Range, class = void>
+	static _PCRE2CPP_CONSTEXPR17 bool is_byte_range_v = false;
+	template<class Range>
+	static _PCRE2CPP_CONSTEXPR17 bool is_byte_range_v<Range,
+	  std::void_t<decltype(std::data(std::declval<const Range&>())), decltype(std::size(std::declval<const Range&>()))> > =
+	  is_byte_v<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<const Range&>()))> > >;
+
+	/// @brief returns view of bytes as chars of 8-bit pcre2 library (nothing is copied)
+	template<class Range>
+	_PCRE2CPP_CONSTEXPR17 std::string_view as_char_view(const Range& bytes) noexcept {
+		static_assert(is_byte_range_v<Range>, "Range must be contiguous range of bytes");
+		return std::string_view(reinterpret_cast<const char*>(std::data(bytes)), std::size(bytes));
+	}
+} // namespace pcre2cpp::utils
+	#endif
+#endif
@@ -0,0 +1,183 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_LITERAL_SEARCHER_HPP_
+	#define _PCRE2CPP_LITERAL_SEARCHER_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/match/match_options.hpp>
+		#include <pcre2cpp/regex/compile_options.hpp>
+		#include <pcre2cpp/types.hpp>
+		#include <pcre2cpp/utils/pcre2_data.hpp>
+
+namespace pcre2cpp::utils {
+	/**
+	 * @brief Substring searcher used instead of pcre2_match for patterns which are pure literals
+	 * @ingroup utils
+	 * @tparam utf UTF type
+	 */
+	template<utf_type utf>
+	class literal_searcher {
+	public:
+		/// @brief returned when literal wasn't found
+		static _PCRE2CPP_CONSTEXPR17 size_t npos = std::numeric_limits<size_t>::max();
+
+	private:
+		using _pcre2_data_t		= pcre2_data<utf>;
+		using _string_type		= typename _pcre2_data_t::string_type;
+		using _string_view_type = typename _pcre2_data_t::string_view_type;
+		using _char_type		= typename _pcre2_data_t::string_char_type;
+		using _traits_type		= typename _string_view_type::traits_type;
+
+		/// @brief compile options which don't change result of matching pure literal
+		static _PCRE2CPP_CONSTEXPR17 uint32_t _literal_compile_options =
+		  PCRE2_LITERAL | PCRE2_CASELESS | PCRE2_ALLOW_EMPTY_CLASS | PCRE2_ALT_BSUX | PCRE2_ALT_CIRCUMFLEX |
+		  PCRE2_ALT_VERBNAMES | PCRE2_DOLLAR_ENDONLY | PCRE2_DOTALL | PCRE2_DUPNAMES | PCRE2_MATCH_UNSET_BACKREF |
+		  PCRE2_MULTILINE | PCRE2_NEVER_BACKSLASH_C | PCRE2_NEVER_UCP | PCRE2_NEVER_UTF | PCRE2_NO_AUTO_CAPTURE |
+		  PCRE2_NO_AUTO_POSSESS | PCRE2_NO_DOTSTAR_ANCHOR | PCRE2_NO_START_OPTIMIZE | PCRE2_NO_UTF_CHECK | PCRE2_UNGREEDY;
+
+		/// @brief match options which don't change result of matching pure literal
+		static _PCRE2CPP_CONSTEXPR17 uint32_t _literal_match_options = PCRE2_COPY_MATCHED_SUBJECT |
+																	   PCRE2_DISABLE_RECURSELOOP_CHECK | PCRE2_NOTBOL |
+																	   PCRE2_NOTEOL | PCRE2_NOTEMPTY | PCRE2_NOTEMPTY_ATSTART |
+																	   PCRE2_NO_JIT | PCRE2_NO_UTF_CHECK;
+
+		/// @brief literal (lowercase when caseless)
+		_string_type _literal;
+		/// @brief true if ascii letters should be matched caseless
+		bool _caseless;
+
+		/// @brief returns true if char is pcre2 metacharacter
+		static _PCRE2CPP_CONSTEXPR17 bool _is_meta_char(const _char_type c) noexcept {
+				switch (c) {
+					case '\\':
+					case '^':
+					case '$':
+					case '.':
+					case '[':
+					case ']':
+					case '|':
+					case '(':
+					case ')':
+					case '?':
+					case '*':
+					case '+':
+					case '{':
+					case '}': return true;
+					default: return false;
+				}
+		}
+
+		/// @brief returns ascii lowercase of char
+		static _PCRE2CPP_CONSTEXPR17 _char_type _to_lower(const _char_type c) noexcept {
+			return c >= 'A' && c <= 'Z' ? static_cast<_char_type>(c - 'A' + 'a') : c;
+		}
+
+		/// @brief returns ascii uppercase of char
+		static _PCRE2CPP_CONSTEXPR17 _char_type _to_upper(const _char_type c) noexcept {
+			return c >= 'a' && c <= 'z' ? static_cast<_char_type>(c - 'a' + 'A') : c;
+		}
+
+		/// @brief returns position of first char from offset which is equal to c or npos
+		static _PCRE2CPP_CONSTEXPR17 size_t _find_char(const _string_view_type text, const size_t offset,
+		  const _char_type c) noexcept {
+			// char_traits::find is memchr for char
+			const _char_type* found = _traits_type::find(text.data() + offset, text.size() - offset, c);
+			return found == nullptr ? npos : static_cast<size_t>(found - text.data());
+		}
+
+		/// @brief returns true if text at pos is caseless equal to literal (without first char)
+		_PCRE2CPP_CONSTEXPR17 bool _caseless_equal_tail(const _string_view_type text, const size_t pos) const noexcept {
+				for (size_t i = 1; i != _literal.size(); ++i) {
+						if (_to_lower(text[pos + i]) != _literal[i]) { return false; }
+				}
+			return true;
+		}
+
+		/// @brief returns position of first caseless occurrence of literal from offset or npos
+		_PCRE2CPP_CONSTEXPR17 size_t _caseless_find(const _string_view_type text, const size_t offset) const noexcept {
+				if (text.size() < _literal.size()) { return npos; }
+
+			const size_t last	 = text.size() - _literal.size();
+			const _char_type lo	 = _literal[0];
+			const _char_type up	 = _to_upper(lo);
+			// next occurrences of both cases of first char are remembered, so every char is scanned at most twice
+			size_t next_lo		 = _find_char(text, offset, lo);
+			size_t next_up		 = lo == up ? npos : _find_char(text, offset, up);
+				while (true) {
+					const size_t pos = std::min(next_lo, next_up);
+						if (pos == npos || pos > last) { return npos; }
+						if (_caseless_equal_tail(text, pos)) { return pos; }
+
+						if (pos == next_lo) { next_lo = _find_char(text, pos + 1, lo); }
+						else { next_up = _find_char(text, pos + 1, up); }
+				}
+		}
+
+	public:
+		/// @brief searcher of literal
+		_PCRE2CPP_CONSTEXPR20 literal_searcher(const _string_view_type literal, const bool caseless) noexcept
+			: _literal(literal), _caseless(caseless) {
+				if (_caseless) {
+						for (auto& c : _literal) { c = _to_lower(c); }
+				}
+		}
+
+		/**
+		 * @brief checks if pattern compiled with given options always gives the same matches as substring search
+		 * @param pattern regex pattern
+		 * @param opts compile options
+		 * @return true if pattern is pure literal
+		 */
+		static _PCRE2CPP_CONSTEXPR17 bool is_literal_pattern(const _string_view_type pattern,
+		  const compile_options opts) noexcept {
+			const uint32_t options = static_cast<uint32_t>(opts);
+				if (pattern.empty() || (options & ~_literal_compile_options) != 0) { return false; }
+
+			const bool literal	= (options & PCRE2_LITERAL) != 0;
+			const bool caseless = (options & PCRE2_CASELESS) != 0;
+				for (const _char_type c : pattern) {
+						if (!literal && _is_meta_char(c)) { return false; }
+						// case folding of non ascii chars depends on tables and UCP
+						if (caseless && static_cast<uint32_t>(c) > 127) { return false; }
+				}
+			return true;
+		}
+
+		/// @brief returns true if match options don't change result of matching pure literal
+		static _PCRE2CPP_CONSTEXPR17 bool is_literal_match(const match_options opts) noexcept {
+			return (static_cast<uint32_t>(opts) & ~_literal_match_options) == 0;
+		}
+
+		/// @brief returns size of literal
+		_PCRE2CPP_CONSTEXPR17 size_t size() const noexcept { return _literal.size(); }
+
+		/// @brief returns position of first occurrence of literal in text from offset or npos
+		_PCRE2CPP_CONSTEXPR17 size_t find(const _string_view_type text, const size_t offset) const noexcept {
+				if (offset > text.size()) { return npos; }
+				if (_caseless) { return _caseless_find(text, offset); }
+
+			const size_t pos = text.find(_literal, offset);
+			return pos == _string_view_type::npos ? npos : pos;
+		}
+	};
+} // namespace pcre2cpp::utils
+	#endif
+#endif
@@ -0,0 +1,108 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#pragma once
+#ifndef _PCRE2CPP_PARSE_VALUE_HPP_
+	#define _PCRE2CPP_PARSE_VALUE_HPP_
+
+	#include <pcre2cpp/config.hpp>
+
+	#if !_PCRE2CPP_HAS_CXX17
+_PCRE2CPP_ERROR("This is only available for c++17 and greater!");
+	#else
+
+		#include <pcre2cpp/types.hpp>
+
+namespace pcre2cpp::utils {
+	/// @brief max size of non char value which can be parsed (it is narrowed into buffer of this size on stack)
+	static _PCRE2CPP_CONSTEXPR17 size_t parse_buffer_size = 128;
+
+	/// @brief true if type can be parsed with parse_value from string view of given char type
+	template<class T, class CharT>
+	static _PCRE2CPP_CONSTEXPR17 bool is_parsable_v = std::is_same_v<T, std::basic_string_view<CharT> > ||
+													  (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>);
+
+	/// @brief true if type is std::optional
+	template<class T>
+	static _PCRE2CPP_CONSTEXPR17 bool is_optional_v = false;
+	template<class T>
+	static _PCRE2CPP_CONSTEXPR17 bool is_optional_v<std::optional<T> > = true;
+
+	/// @brief parses whole range of chars into arithmetic value with std::from_chars
+	template<class T>
+	std::optional<T> from_chars_value(const char* first, const char* last) noexcept {
+		T value {};
+		const auto [ptr, error] = std::from_chars(first, last, value);
+			if (error != std::errc() || ptr != last) { return std::nullopt; }
+		return value;
+	}
+
+		#if !defined(__cpp_lib_to_chars)
+	/// @brief parses whole range of chars into floating point value with std::strtold (used when from_chars doesn't support it)
+	template<class T>
+	std::optional<T> strtold_value(const char* first, const char* last) noexcept {
+			if (first == last || static_cast<size_t>(last - first) > parse_buffer_size) { return std::nullopt; }
+
+		char buffer[parse_buffer_size + 1];
+		std::copy(first, last, buffer);
+		buffer[last - first] = '\0';
+
+		char* end				= nullptr;
+		const long double value = std::strtold(buffer, &end);
+			if (end != buffer + (last - first)) { return std::nullopt; }
+		return static_cast<T>(value);
+	}
+		#endif
+
+	/// @brief parses whole range of chars into arithmetic value without allocation
+	template<class T>
+	std::optional<T> parse_chars(const char* first, const char* last) noexcept {
+		#if defined(__cpp_lib_to_chars)
+		return from_chars_value<T>(first, last);
+		#else
+			if _PCRE2CPP_CONSTEXPR17 (std::is_floating_point_v<T>) { return strtold_value<T>(first, last); }
+			else { return from_chars_value<T>(first, last); }
+		#endif
+	}
+
+	/**
+	 * @brief parses whole text into value without allocation (string views are returned as they are)
+	 * @tparam T arithmetic type or string view type
+	 * @tparam CharT char type of text
+	 * @param text text to parse
+	 * @return parsed value or nullopt when text isn't valid value of T
+	 */
+	template<class T, class CharT>
+	std::optional<T> parse_value(const std::basic_string_view<CharT> text) noexcept {
+		static_assert(is_parsable_v<T, CharT>, "Only arithmetic types (without bool) and string views can be parsed");
+
+			if _PCRE2CPP_CONSTEXPR17 (std::is_same_v<T, std::basic_string_view<CharT> >) { return text; }
+			else if _PCRE2CPP_CONSTEXPR17 (std::is_same_v<CharT, char>) {
+				return parse_chars<T>(text.data(), text.data() + text.size());
+			}
+			else {
+					if (text.size() > parse_buffer_size) { return std::nullopt; }
+
+				// numbers are ascii only, so wider chars are narrowed
+				char buffer[parse_buffer_size];
+					for (size_t i = 0; i != text.size(); ++i) {
+							if (static_cast<uint32_t>(text[i]) > 127) { return std::nullopt; }
+						buffer[i] = static_cast<char>(text[i]);
+					}
+				return parse_chars<T>(buffer, buffer + text.size());
+			}
+	}
+} // namespace pcre2cpp::utils
+	#endif
+#endif
@@ -23,6 +23,17 @@ _PCRE2CPP_ERROR("This is only available for c++17 and greater!");
 	#else
 		#include <pcre2cpp/types.hpp>
 
+/**
+ * @def _PCRE2CPP_HAS_HEAPFRAMES_SIZE
+ * @brief check if pcre2 reports size of heap frames used by match (pcre2_get_match_data_heapframes_size, PCRE2 10.45+)
+ * @ingroup utils
+ */
+		#if PCRE2_MAJOR > 10 || (PCRE2_MAJOR == 10 && PCRE2_MINOR >= 45)
+			#define _PCRE2CPP_HAS_HEAPFRAMES_SIZE 1
+		#else
+			#define _PCRE2CPP_HAS_HEAPFRAMES_SIZE 0
+		#endif
+
 namespace pcre2cpp {
 	/**
 	 * @brief Enum with supported utf types
@@ -89,6 +100,8 @@ namespace pcre2cpp::utils {
 		using match_data_type						 = pcre2_match_data_8;
 		/// @brief pcre2 match context structure type for utf-8
 		using match_ctx_type						 = pcre2_match_context_8;
+		/// @brief pcre2 callout block structure type for utf-8
+		using callout_block_type					 = pcre2_callout_block_8;
 			#pragma endregion
 
 			#pragma region PCRE2_STRING
@@ -121,9 +134,16 @@ namespace pcre2cpp::utils {
 
 			#pragma region UTF_INFO
 		/// @brief utf enum value for utf-8
-		static _PCRE2CPP_CONSTEXPR17 utf_type uft	 = utf_type::UTF_8;
+		static _PCRE2CPP_CONSTEXPR17 utf_type uft		  = utf_type::UTF_8;
 		/// @brief utf byte size for utf-8
-		static _PCRE2CPP_CONSTEXPR17 size_t utf_size = 8;
+		static _PCRE2CPP_CONSTEXPR17 size_t utf_size	  = 8;
+		/// @brief max count of code units of one character in utf-8
+		static _PCRE2CPP_CONSTEXPR17 size_t max_char_size = 4;
+
+		/// @brief returns true if code unit isn't first code unit of character in utf-8
+		static _PCRE2CPP_CONSTEXPR17 bool is_char_continuation(const string_char_type c) noexcept {
+			return (static_cast<uint8_t>(c) & 0xC0) == 0x80;
+		}
 			#pragma endregion
 
 			#pragma region CODE_FUNCTIONS
@@ -135,12 +155,67 @@ namespace pcre2cpp::utils {
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(code_type*)> code_free = pcre2_code_free_8;
 			#pragma endregion
 
+			#pragma region GENERAL_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_general_context_create function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<general_ctx_type*(mstd::c_func_t<void*(size_t, void*)>,
+		  mstd::c_func_t<void(void*, void*)>, void*)>
+			general_ctx_create = pcre2_general_context_create_8;
+		/// @brief pointer to pcre2_general_context_free function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(general_ctx_type*)> general_ctx_free =
+		  pcre2_general_context_free_8;
+			#pragma endregion
+
+			#pragma region COMPILE_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_compile_context_create function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<compile_ctx_type*(general_ctx_type*)> compile_ctx_create =
+		  pcre2_compile_context_create_8;
+		/// @brief pointer to pcre2_compile_context_free function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(compile_ctx_type*)> compile_ctx_free =
+		  pcre2_compile_context_free_8;
+		/// @brief pointer to pcre2_set_newline function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_newline =
+		  pcre2_set_newline_8;
+		/// @brief pointer to pcre2_set_bsr function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_bsr = pcre2_set_bsr_8;
+		/// @brief pointer to pcre2_set_max_pattern_length function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, size_t)> set_max_pattern_length =
+		  pcre2_set_max_pattern_length_8;
+		/// @brief pointer to pcre2_set_parens_nest_limit function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_parens_nest_limit =
+		  pcre2_set_parens_nest_limit_8;
+		/// @brief pointer to pcre2_set_character_tables function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, const uint8_t*)> set_character_tables =
+		  pcre2_set_character_tables_8;
+		/// @brief pointer to pcre2_maketables function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<const uint8_t*(general_ctx_type*)> maketables =
+		  pcre2_maketables_8;
+		/// @brief pointer to pcre2_maketables_free function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(general_ctx_type*, const uint8_t*)> maketables_free =
+		  pcre2_maketables_free_8;
+			#pragma endregion
+
 			#pragma region MATCH_DATA_FUNCTIONS
 		/// @brief pointer to pcre2_match_data_create_from_pattern function for utf-8
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_data_type*(const code_type*, general_ctx_type*)>
 		  match_data_from_pattern = pcre2_match_data_create_from_pattern_8;
 		/// @brief pointer to pcre2_match_data_free function for utf-8
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(match_data_type*)> match_data_free = pcre2_match_data_free_8;
+		/// @brief pointer to pcre2_match_data_create function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_data_type*(uint32_t, general_ctx_type*)> match_data_create =
+		  pcre2_match_data_create_8;
+			#pragma endregion
+
+			#pragma region MATCH_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_match_context_create function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_ctx_type*(general_ctx_type*)> match_ctx_create =
+		  pcre2_match_context_create_8;
+		/// @brief pointer to pcre2_match_context_free function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(match_ctx_type*)> match_ctx_free =
+		  pcre2_match_context_free_8;
+		/// @brief pointer to pcre2_set_callout function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17
+		  mstd::c_func_t<int(match_ctx_type*, mstd::c_func_t<int(callout_block_type*, void*)>, void*)>
+			set_callout = pcre2_set_callout_8;
 			#pragma endregion
 
 			#pragma region MATCH_FUNCTIONS
@@ -148,6 +223,13 @@ namespace pcre2cpp::utils {
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17
 		  mstd::c_func_t<int(const code_type*, sptr_type, size_t, size_t, uint32_t, match_data_type*, match_ctx_type*)>
 			match = pcre2_match_8;
+		/// @brief pointer to pcre2_get_mark function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<sptr_type(match_data_type*)> get_mark = pcre2_get_mark_8;
+			#if _PCRE2CPP_HAS_HEAPFRAMES_SIZE
+		/// @brief pointer to pcre2_get_match_data_heapframes_size function for utf-8
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<size_t(match_data_type*)> get_heapframes_size =
+		  pcre2_get_match_data_heapframes_size_8;
+			#endif
 			#pragma endregion
 
 			#pragma region OVECTOR_FUNCTIONS
@@ -204,6 +286,8 @@ namespace pcre2cpp::utils {
 		using match_data_type						 = pcre2_match_data_16;
 		/// @brief pcre2 match context structure type for utf-16
 		using match_ctx_type						 = pcre2_match_context_16;
+		/// @brief pcre2 callout block structure type for utf-16
+		using callout_block_type					 = pcre2_callout_block_16;
 			#pragma endregion
 
 			#pragma region PCRE2_STRING
@@ -229,9 +313,16 @@ namespace pcre2cpp::utils {
 
 			#pragma region UTF_INFO
 		/// @brief utf enum value for utf-16
-		static _PCRE2CPP_CONSTEXPR17 utf_type uft	 = utf_type::UTF_16;
+		static _PCRE2CPP_CONSTEXPR17 utf_type uft		  = utf_type::UTF_16;
 		/// @brief utf byte size for utf-16
-		static _PCRE2CPP_CONSTEXPR17 size_t utf_size = 16;
+		static _PCRE2CPP_CONSTEXPR17 size_t utf_size	  = 16;
+		/// @brief max count of code units of one character in utf-16
+		static _PCRE2CPP_CONSTEXPR17 size_t max_char_size = 2;
+
+		/// @brief returns true if code unit isn't first code unit of character in utf-16
+		static _PCRE2CPP_CONSTEXPR17 bool is_char_continuation(const string_char_type c) noexcept {
+			return (static_cast<uint16_t>(c) & 0xFC00) == 0xDC00;
+		}
 			#pragma endregion
 
 			#pragma region CODE_FUNCTIONS
@@ -243,12 +334,67 @@ namespace pcre2cpp::utils {
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(code_type*)> code_free = pcre2_code_free_16;
 			#pragma endregion
 
+			#pragma region GENERAL_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_general_context_create function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<general_ctx_type*(mstd::c_func_t<void*(size_t, void*)>,
+		  mstd::c_func_t<void(void*, void*)>, void*)>
+			general_ctx_create = pcre2_general_context_create_16;
+		/// @brief pointer to pcre2_general_context_free function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(general_ctx_type*)> general_ctx_free =
+		  pcre2_general_context_free_16;
+			#pragma endregion
+
+			#pragma region COMPILE_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_compile_context_create function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<compile_ctx_type*(general_ctx_type*)> compile_ctx_create =
+		  pcre2_compile_context_create_16;
+		/// @brief pointer to pcre2_compile_context_free function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(compile_ctx_type*)> compile_ctx_free =
+		  pcre2_compile_context_free_16;
+		/// @brief pointer to pcre2_set_newline function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_newline =
+		  pcre2_set_newline_16;
+		/// @brief pointer to pcre2_set_bsr function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_bsr = pcre2_set_bsr_16;
+		/// @brief pointer to pcre2_set_max_pattern_length function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, size_t)> set_max_pattern_length =
+		  pcre2_set_max_pattern_length_16;
+		/// @brief pointer to pcre2_set_parens_nest_limit function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_parens_nest_limit =
+		  pcre2_set_parens_nest_limit_16;
+		/// @brief pointer to pcre2_set_character_tables function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, const uint8_t*)> set_character_tables =
+		  pcre2_set_character_tables_16;
+		/// @brief pointer to pcre2_maketables function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<const uint8_t*(general_ctx_type*)> maketables =
+		  pcre2_maketables_16;
+		/// @brief pointer to pcre2_maketables_free function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(general_ctx_type*, const uint8_t*)> maketables_free =
+		  pcre2_maketables_free_16;
+			#pragma endregion
+
 			#pragma region MATCH_DATA_FUNCTIONS
 		/// @brief pointer to pcre2_match_data_create_from_pattern function for utf-16
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_data_type*(const code_type*, general_ctx_type*)>
 		  match_data_from_pattern = pcre2_match_data_create_from_pattern_16;
 		/// @brief pointer to pcre2_match_data_free function for utf-16
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(match_data_type*)> match_data_free = pcre2_match_data_free_16;
+		/// @brief pointer to pcre2_match_data_create function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_data_type*(uint32_t, general_ctx_type*)> match_data_create =
+		  pcre2_match_data_create_16;
+			#pragma endregion
+
+			#pragma region MATCH_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_match_context_create function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_ctx_type*(general_ctx_type*)> match_ctx_create =
+		  pcre2_match_context_create_16;
+		/// @brief pointer to pcre2_match_context_free function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(match_ctx_type*)> match_ctx_free =
+		  pcre2_match_context_free_16;
+		/// @brief pointer to pcre2_set_callout function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17
+		  mstd::c_func_t<int(match_ctx_type*, mstd::c_func_t<int(callout_block_type*, void*)>, void*)>
+			set_callout = pcre2_set_callout_16;
 			#pragma endregion
 
 			#pragma region MATCH_FUNCTIONS
@@ -256,6 +402,13 @@ namespace pcre2cpp::utils {
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17
 		  mstd::c_func_t<int(const code_type*, sptr_type, size_t, size_t, uint32_t, match_data_type*, match_ctx_type*)>
 			match = pcre2_match_16;
+		/// @brief pointer to pcre2_get_mark function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<sptr_type(match_data_type*)> get_mark = pcre2_get_mark_16;
+			#if _PCRE2CPP_HAS_HEAPFRAMES_SIZE
+		/// @brief pointer to pcre2_get_match_data_heapframes_size function for utf-16
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<size_t(match_data_type*)> get_heapframes_size =
+		  pcre2_get_match_data_heapframes_size_16;
+			#endif
 			#pragma endregion
 
 			#pragma region OVECTOR_FUNCTIONS
@@ -312,6 +465,8 @@ namespace pcre2cpp::utils {
 		using match_data_type						 = pcre2_match_data_32;
 		/// @brief pcre2 match context structure type for utf-32
 		using match_ctx_type						 = pcre2_match_context_32;
+		/// @brief pcre2 callout block structure type for utf-32
+		using callout_block_type					 = pcre2_callout_block_32;
 			#pragma endregion
 
 			#pragma region PCRE2_STRING
@@ -337,9 +492,16 @@ namespace pcre2cpp::utils {
 
 			#pragma region UTF_INFO
 		/// @brief utf enum value for utf-32
-		static _PCRE2CPP_CONSTEXPR17 utf_type uft	 = utf_type::UTF_32;
+		static _PCRE2CPP_CONSTEXPR17 utf_type uft		  = utf_type::UTF_32;
 		/// @brief utf byte size for utf-32
-		static _PCRE2CPP_CONSTEXPR17 size_t utf_size = 32;
+		static _PCRE2CPP_CONSTEXPR17 size_t utf_size	  = 32;
+		/// @brief max count of code units of one character in utf-32
+		static _PCRE2CPP_CONSTEXPR17 size_t max_char_size = 1;
+
+		/// @brief returns true if code unit isn't first code unit of character in utf-32
+		static _PCRE2CPP_CONSTEXPR17 bool is_char_continuation([[maybe_unused]] const string_char_type c) noexcept {
+			return false;
+		}
 			#pragma endregion
 
 			#pragma region CODE_FUNCTIONS
@@ -351,12 +513,67 @@ namespace pcre2cpp::utils {
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(code_type*)> code_free = pcre2_code_free_32;
 			#pragma endregion
 
+			#pragma region GENERAL_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_general_context_create function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<general_ctx_type*(mstd::c_func_t<void*(size_t, void*)>,
+		  mstd::c_func_t<void(void*, void*)>, void*)>
+			general_ctx_create = pcre2_general_context_create_32;
+		/// @brief pointer to pcre2_general_context_free function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(general_ctx_type*)> general_ctx_free =
+		  pcre2_general_context_free_32;
+			#pragma endregion
+
+			#pragma region COMPILE_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_compile_context_create function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<compile_ctx_type*(general_ctx_type*)> compile_ctx_create =
+		  pcre2_compile_context_create_32;
+		/// @brief pointer to pcre2_compile_context_free function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(compile_ctx_type*)> compile_ctx_free =
+		  pcre2_compile_context_free_32;
+		/// @brief pointer to pcre2_set_newline function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_newline =
+		  pcre2_set_newline_32;
+		/// @brief pointer to pcre2_set_bsr function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_bsr = pcre2_set_bsr_32;
+		/// @brief pointer to pcre2_set_max_pattern_length function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, size_t)> set_max_pattern_length =
+		  pcre2_set_max_pattern_length_32;
+		/// @brief pointer to pcre2_set_parens_nest_limit function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, uint32_t)> set_parens_nest_limit =
+		  pcre2_set_parens_nest_limit_32;
+		/// @brief pointer to pcre2_set_character_tables function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<int(compile_ctx_type*, const uint8_t*)> set_character_tables =
+		  pcre2_set_character_tables_32;
+		/// @brief pointer to pcre2_maketables function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<const uint8_t*(general_ctx_type*)> maketables =
+		  pcre2_maketables_32;
+		/// @brief pointer to pcre2_maketables_free function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(general_ctx_type*, const uint8_t*)> maketables_free =
+		  pcre2_maketables_free_32;
+			#pragma endregion
+
 			#pragma region MATCH_DATA_FUNCTIONS
 		/// @brief pointer to pcre2_match_data_create_from_pattern function for utf-32
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_data_type*(const code_type*, general_ctx_type*)>
 		  match_data_from_pattern = pcre2_match_data_create_from_pattern_32;
 		/// @brief pointer to pcre2_match_data_free function for utf-32
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(match_data_type*)> match_data_free = pcre2_match_data_free_32;
+		/// @brief pointer to pcre2_match_data_create function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_data_type*(uint32_t, general_ctx_type*)> match_data_create =
+		  pcre2_match_data_create_32;
+			#pragma endregion
+
+			#pragma region MATCH_CONTEXT_FUNCTIONS
+		/// @brief pointer to pcre2_match_context_create function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<match_ctx_type*(general_ctx_type*)> match_ctx_create =
+		  pcre2_match_context_create_32;
+		/// @brief pointer to pcre2_match_context_free function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<void(match_ctx_type*)> match_ctx_free =
+		  pcre2_match_context_free_32;
+		/// @brief pointer to pcre2_set_callout function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17
+		  mstd::c_func_t<int(match_ctx_type*, mstd::c_func_t<int(callout_block_type*, void*)>, void*)>
+			set_callout = pcre2_set_callout_32;
 			#pragma endregion
 
 			#pragma region MATCH_FUNCTIONS
@@ -364,6 +581,13 @@ namespace pcre2cpp::utils {
 		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17
 		  mstd::c_func_t<int(const code_type*, sptr_type, size_t, size_t, uint32_t, match_data_type*, match_ctx_type*)>
 			match = pcre2_match_32;
+		/// @brief pointer to pcre2_get_mark function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<sptr_type(match_data_type*)> get_mark = pcre2_get_mark_32;
+			#if _PCRE2CPP_HAS_HEAPFRAMES_SIZE
+		/// @brief pointer to pcre2_get_match_data_heapframes_size function for utf-32
+		static _PCRE2CPP_PCRE2_FUNC_CONSTEXPR17 mstd::c_func_t<size_t(match_data_type*)> get_heapframes_size =
+		  pcre2_get_match_data_heapframes_size_32;
+			#endif
 			#pragma endregion
 
 			#pragma region OVECTOR_FUNCTIONS
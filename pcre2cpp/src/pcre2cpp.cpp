@@ -0,0 +1,100 @@
+/*
+ * pcre2cpp - PCRE2 cpp wrapper
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ *
+ * PCRE2 library included in this project:
+ * Copyright (c) 2016-2024, University of Cambridge.
+ *
+ * See the LICENSE_PCRE2 file for details: https://github.com/MAIPA01/pcre2cpp/blob/main/LICENSE_PCRE2
+ */
+
+#define PCRE2CPP_COMPILED_LIB_SOURCE
+#include <pcre2cpp/pcre2cpp.hpp>
+
+// Explicit instantiations of pcre2cpp templates for all enabled UTF types. Code which includes headers with
+// PCRE2CPP_COMPILED_LIB defined only declares them (extern template), so they are compiled once here. Member functions
+// defined in class are still inline, so hot paths can be inlined at call site.
+
+namespace pcre2cpp {
+#if _PCRE2CPP_HAS_UTF8
+	template std::string generate_error_message<utf_type::UTF_8>(const int) noexcept;
+	template std::string generate_error_message<utf_type::UTF_8>(const int, const size_t) noexcept;
+	template std::string generate_subexpression_not_found_message<utf_type::UTF_8>(const std::string_view) noexcept;
+	template std::string convert_any_utf_to_utf8<utf_type::UTF_8>(const std::string_view) noexcept;
+
+	#if _PCRE2CPP_HAS_EXCEPTIONS
+	template class basic_pcre2cpp_exception<utf_type::UTF_8>;
+	template class basic_regex_exception<utf_type::UTF_8>;
+	template class basic_match_result_exception<utf_type::UTF_8>;
+	#endif
+
+	template class basic_match_result<utf_type::UTF_8>;
+	template class basic_match_view<utf_type::UTF_8>;
+	template class basic_match_batch<utf_type::UTF_8>;
+	template class basic_column<utf_type::UTF_8>;
+	template class basic_column_batch<utf_type::UTF_8>;
+	template class basic_compile_context<utf_type::UTF_8>;
+	template class basic_regex<utf_type::UTF_8>;
+	template class basic_regex_profiler<utf_type::UTF_8>;
+	template class basic_backtracking_analyzer<utf_type::UTF_8>;
+	template class basic_tokenizer<utf_type::UTF_8>;
+	template class basic_match_index<utf_type::UTF_8>;
+	template class basic_stream_matcher<utf_type::UTF_8>;
+#endif
+
+#if _PCRE2CPP_HAS_UTF16
+	template std::u16string generate_error_message<utf_type::UTF_16>(const int) noexcept;
+	template std::u16string generate_error_message<utf_type::UTF_16>(const int, const size_t) noexcept;
+	template std::u16string generate_subexpression_not_found_message<utf_type::UTF_16>(const std::u16string_view) noexcept;
+	template std::string convert_any_utf_to_utf8<utf_type::UTF_16>(const std::u16string_view) noexcept;
+
+	#if _PCRE2CPP_HAS_EXCEPTIONS
+	template class basic_pcre2cpp_exception<utf_type::UTF_16>;
+	template class basic_regex_exception<utf_type::UTF_16>;
+	template class basic_match_result_exception<utf_type::UTF_16>;
+	#endif
+
+	template class basic_match_result<utf_type::UTF_16>;
+	template class basic_match_view<utf_type::UTF_16>;
+	template class basic_match_batch<utf_type::UTF_16>;
+	template class basic_column<utf_type::UTF_16>;
+	template class basic_column_batch<utf_type::UTF_16>;
+	template class basic_compile_context<utf_type::UTF_16>;
+	template class basic_regex<utf_type::UTF_16>;
+	template class basic_regex_profiler<utf_type::UTF_16>;
+	template class basic_backtracking_analyzer<utf_type::UTF_16>;
+	template class basic_tokenizer<utf_type::UTF_16>;
+	template class basic_match_index<utf_type::UTF_16>;
+	template class basic_stream_matcher<utf_type::UTF_16>;
+#endif
+
+#if _PCRE2CPP_HAS_UTF32
+	template std::u32string generate_error_message<utf_type::UTF_32>(const int) noexcept;
+	template std::u32string generate_error_message<utf_type::UTF_32>(const int, const size_t) noexcept;
+	template std::u32string generate_subexpression_not_found_message<utf_type::UTF_32>(const std::u32string_view) noexcept;
+	template std::string convert_any_utf_to_utf8<utf_type::UTF_32>(const std::u32string_view) noexcept;
+
+	#if _PCRE2CPP_HAS_EXCEPTIONS
+	template class basic_pcre2cpp_exception<utf_type::UTF_32>;
+	template class basic_regex_exception<utf_type::UTF_32>;
+	template class basic_match_result_exception<utf_type::UTF_32>;
+	#endif
+
+	template class basic_match_result<utf_type::UTF_32>;
+	template class basic_match_view<utf_type::UTF_32>;
+	template class basic_match_batch<utf_type::UTF_32>;
+	template class basic_column<utf_type::UTF_32>;
+	template class basic_column_batch<utf_type::UTF_32>;
+	template class basic_compile_context<utf_type::UTF_32>;
+	template class basic_regex<utf_type::UTF_32>;
+	template class basic_regex_profiler<utf_type::UTF_32>;
+	template class basic_backtracking_analyzer<utf_type::UTF_32>;
+	template class basic_tokenizer<utf_type::UTF_32>;
+	template class basic_match_index<utf_type::UTF_32>;
+	template class basic_stream_matcher<utf_type::UTF_32>;
+#endif
+} // namespace pcre2cpp
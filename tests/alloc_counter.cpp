@@ -0,0 +1,41 @@
+#include <alloc_counter.hpp>
+#include <cstdlib>
+#include <new_delete_counter.hpp>
+
+namespace {
+	/// @brief allocations made by pcre2 in current thread since its start
+	thread_local alloc_counter::alloc_stats counted;
+
+	void* pcre2_malloc(const size_t size, void*) {
+		++counted.pcre2_allocations;
+		counted.pcre2_bytes += size;
+		return std::malloc(size);
+	}
+
+	void pcre2_free(void* ptr, void*) { std::free(ptr); }
+
+	/// @brief returns allocations made by current thread since its start
+	alloc_counter::alloc_stats get_thread_stats() noexcept {
+		const new_delete_counter::new_stats new_stats = new_delete_counter::get_thread_stats();
+		alloc_counter::alloc_stats stats			  = counted;
+		stats.allocations							  = new_stats.allocations;
+		stats.bytes									  = new_stats.bytes;
+		return stats;
+	}
+} // namespace
+
+namespace alloc_counter {
+	pcre2cpp::memory_functions get_pcre2_memory_functions() noexcept { return { pcre2_malloc, pcre2_free, nullptr }; }
+
+	scope::scope() noexcept : _start(get_thread_stats()) {}
+
+	alloc_stats scope::get() const noexcept {
+		const alloc_stats now = get_thread_stats();
+		alloc_stats stats;
+		stats.allocations		= now.allocations - _start.allocations;
+		stats.bytes				= now.bytes - _start.bytes;
+		stats.pcre2_allocations = now.pcre2_allocations - _start.pcre2_allocations;
+		stats.pcre2_bytes		= now.pcre2_bytes - _start.pcre2_bytes;
+		return stats;
+	}
+} // namespace alloc_counter
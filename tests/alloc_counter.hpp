@@ -0,0 +1,51 @@
+#pragma once
+#ifndef _PCRE2CPP_TEST_ALLOC_COUNTER_HPP_
+	#define _PCRE2CPP_TEST_ALLOC_COUNTER_HPP_
+
+	#include <cstddef>
+	#include <pcre2cpp/pcre2cpp.hpp>
+
+namespace alloc_counter {
+	/// @brief allocations counted in scope
+	struct alloc_stats {
+		/// @brief count of global operator new calls
+		size_t allocations		 = 0;
+		/// @brief bytes requested by global operator new
+		size_t bytes			 = 0;
+		/// @brief count of allocations made by pcre2 (only with compile context from get_compile_context)
+		size_t pcre2_allocations = 0;
+		/// @brief bytes requested by pcre2
+		size_t pcre2_bytes		 = 0;
+
+		/// @brief returns count of all allocations
+		size_t total() const noexcept { return allocations + pcre2_allocations; }
+	};
+
+	/// @brief returns memory functions which count allocations made by pcre2
+	pcre2cpp::memory_functions get_pcre2_memory_functions() noexcept;
+
+	/// @brief returns compile context which makes pcre2 allocations of compiled regexes counted
+	template<pcre2cpp::utf_type utf = pcre2cpp::default_utf_type>
+	pcre2cpp::basic_compile_context<utf> get_compile_context() {
+		return pcre2cpp::basic_compile_context<utf>(get_pcre2_memory_functions());
+	}
+
+	/// @brief counts allocations of current thread since it was created (global operator new is replaced by
+	/// new_delete_counter.cpp)
+	class scope {
+	private:
+		/// @brief allocations of current thread made before scope was created
+		alloc_stats _start;
+
+	public:
+		scope() noexcept;
+
+		scope(const scope&)			   = delete;
+		scope& operator=(const scope&) = delete;
+
+		/// @brief returns allocations counted since scope was created
+		alloc_stats get() const noexcept;
+	};
+} // namespace alloc_counter
+
+#endif
@@ -1,3 +1,6 @@
+#include <alloc_counter.hpp>
+#include <cstdio>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <pch.hpp>
 
@@ -89,6 +92,41 @@ TEST(MATCH_TESTS, MATCH_AT_SPECIFIED_OFFSET_WITH_RESULT) {
 	EXPECT_EQ(result.get_result_relative_offset(), match_result::bad_offset);
 }
 
+// DOESN'T SEARCH REST OF TEXT WHEN THERE IS NO MATCH AT GIVEN LOCATION
+TEST(MATCH_TESTS, MATCH_AT_IS_ANCHORED) {
+	const regex expression("\\d+");
+
+	match_result result;
+	EXPECT_FALSE(expression.match_at("a23", result, 0));
+	EXPECT_TRUE(result.has_result());
+	EXPECT_FALSE(result.has_value());
+	EXPECT_FALSE(expression.match_at("abc", result, 0));
+	EXPECT_TRUE(result.has_result());
+	EXPECT_FALSE(result.has_value());
+
+	EXPECT_TRUE(expression.match_at("a23", result, 1));
+	EXPECT_EQ(result.get_result_value(), "23");
+}
+
+// MATCHES ONLY WHOLE TEXT FROM GIVEN LOCATION
+TEST(MATCH_TESTS, FULL_MATCH) {
+	const regex expression("\\d+");
+
+	EXPECT_TRUE(expression.full_match("123"));
+	EXPECT_FALSE(expression.full_match("123a"));
+	EXPECT_FALSE(expression.full_match("a123"));
+	EXPECT_TRUE(expression.full_match("a123", 1));
+
+	match_result result;
+	EXPECT_TRUE(expression.full_match("a123", result, 1));
+	EXPECT_EQ(result.get_result_value(), "123");
+	EXPECT_EQ(result.get_result_global_offset(), 1);
+
+	EXPECT_FALSE(expression.full_match("123a", result));
+	EXPECT_TRUE(result.has_result());
+	EXPECT_FALSE(result.has_value());
+}
+
 // MATCHES AND TRIES TO GET RESULTS FROM SUBEXPRESSION
 TEST(MATCH_TESTS, MATCH_WITH_INDEXED_SUBEXPRESSION) {
 	const regex expression("(\\d+)(a)");
@@ -170,6 +208,329 @@ TEST(MATCH_TESTS, MATCH_ALL) {
 	EXPECT_EQ(results[1].get_result_value(), "3");
 }
 
+// BATCH OWNS SUBJECT, SO MATCHES OUTLIVE TEXT AND REGEX
+TEST(MATCH_TESTS, MATCH_ALL_BATCH) {
+	match_batch batch;
+	{
+		const std::string text = "x=1 y= z=34";
+		const regex expression("(?<key>\\w)=(?<value>\\d+)?");
+		EXPECT_TRUE(expression.match_all(text, batch));
+	}
+
+	ASSERT_EQ(batch.size(), 3);
+	EXPECT_EQ(batch.get_subject(), "x=1 y= z=34");
+	EXPECT_EQ(batch.get_offsets().size(), 3 * batch.get_pairs_count() * 2);
+	EXPECT_EQ(batch[0].get_result_value(), "x=1");
+	EXPECT_EQ(batch[1].get_sub_result_value("key"), "y");
+	EXPECT_FALSE(batch[1].has_sub_value("value"));
+	EXPECT_EQ(batch[2].get_sub_result_value("value"), "34");
+	EXPECT_EQ(batch[2].get_result_global_offset(), 7);
+	EXPECT_FALSE(batch[3].has_value());
+
+	std::vector<match_result> results;
+	const regex empty_expression("a*");
+	EXPECT_TRUE(empty_expression.match_all("baab", results));
+	EXPECT_TRUE(empty_expression.match_all("baab", batch));
+	EXPECT_EQ(batch.size(), results.size());
+
+	const auto subject = std::make_shared<const std::string>("ab ab");
+	EXPECT_TRUE(regex("ab").match_all(subject, batch));
+	EXPECT_EQ(batch.size(), 2);
+	EXPECT_EQ(batch.get_subject_ptr(), subject);
+	EXPECT_FALSE(regex("c").match_all(subject, batch));
+	EXPECT_TRUE(batch.empty());
+}
+
+// MATCHES BYTES WITHOUT UTF SEMANTICS AND COPIES
+TEST(MATCH_TESTS, BINARY_MATCH) {
+	const binary_regex expression("\\x00(?<len>.)(?<payload>\\xC3.)");
+	const std::vector<uint8_t> packet = { 0xFF, 0x00, 0x02, 0xC3, 0xFF, 0x00 };
+
+	byte_match_view view;
+	EXPECT_TRUE(expression.match(packet, view));
+	EXPECT_EQ(view.get_result_global_offset(), 1);
+	EXPECT_EQ(view.get_subject().data(), packet.data());
+	EXPECT_EQ(view.get_sub_result_value("len")[0], 0x02);
+	EXPECT_EQ(view.get_sub_result_value("payload").size(), 2);
+	EXPECT_EQ(view.get_sub_result_value("payload")[1], 0xFF);
+
+	const std::byte bytes[] = { std::byte { 0x00 }, std::byte { 0x01 }, std::byte { 0xC3 }, std::byte { 0x28 } };
+	EXPECT_TRUE(expression.any_match(bytes));
+	EXPECT_EQ(binary_regex("\\x00").count_matches(packet), 2);
+	EXPECT_FALSE(expression.match(packet, view, 2));
+	EXPECT_FALSE(view.has_value());
+
+	EXPECT_FALSE(pcre2cpp::is_pattern_valid("(*UTF)a", compile_options_bits::NeverUTF));
+}
+
+// COUNTS ALL MATCHES WITHOUT CREATING RESULTS
+TEST(MATCH_TESTS, COUNT_MATCHES) {
+	const regex expression("(\\d)(\\d)?");
+
+	EXPECT_EQ(expression.count_matches("Ala ma 23 lata i 3 koty"), 2);
+	EXPECT_EQ(expression.count_matches("Ala ma 23 lata i 3 koty", 9), 1);
+	EXPECT_EQ(expression.count_matches("Ala ma kota"), 0);
+}
+
+// COUNTS EMPTY MATCHES THE SAME WAY AS MATCH ALL
+TEST(MATCH_TESTS, COUNT_EMPTY_MATCHES) {
+	std::vector<match_result> results;
+	const regex expression("a*");
+
+	EXPECT_TRUE(expression.match_all("baab", results));
+	EXPECT_EQ(results.size(), 4);
+	EXPECT_EQ(expression.count_matches("baab"), results.size());
+}
+
+// SKIPS WHOLE UTF CHARACTER AFTER EMPTY MATCH
+TEST(MATCH_TESTS, COUNT_EMPTY_UTF_MATCHES) {
+	std::vector<match_result> results;
+	match_batch batch;
+	const regex expression("x*", compile_options_bits::UTF);
+	const std::string text = "\xC4\x85\xC4\x85\xC4\x85x";
+
+	EXPECT_TRUE(expression.match_all(text, results));
+	ASSERT_EQ(results.size(), 5);
+	EXPECT_EQ(results[3].get_result_value(), "x");
+	EXPECT_EQ(results[4].get_result_global_offset(), text.size());
+	EXPECT_EQ(expression.count_matches(text), 5);
+	EXPECT_TRUE(expression.match_all(text, batch));
+	EXPECT_EQ(batch.size(), 5);
+
+	std::string output;
+	expression.replace_with(text, std::back_inserter(output), [](const match_view&) { return std::string_view("-"); });
+	EXPECT_EQ(output, "-\xC4\x85-\xC4\x85-\xC4\x85--");
+
+	#if _PCRE2CPP_HAS_UTF16
+	// surrogate pair is one character
+	EXPECT_EQ(u16regex(u"x*", compile_options_bits::UTF).count_matches(u"\u0105\U0001D11Ex"), 4);
+	#endif
+}
+
+// CHECKS IF ANY MATCH EXISTS WITHOUT CREATING RESULT
+TEST(MATCH_TESTS, ANY_MATCH) {
+	const regex expression("(\\d)\\d{2}");
+
+	EXPECT_TRUE(expression.any_match("ab123"));
+	EXPECT_FALSE(expression.any_match("ab12"));
+	EXPECT_FALSE(expression.any_match("ab123", 3));
+	EXPECT_FALSE(expression.any_match("ab123", 10));
+}
+
+// USES SUBSTRING SEARCH ONLY FOR PURE LITERALS
+TEST(LITERAL_TESTS, LITERAL_DETECTION) {
+	EXPECT_TRUE(regex("error").is_literal());
+	EXPECT_TRUE(regex("a.b", compile_options_bits::Literal).is_literal());
+	EXPECT_TRUE(regex("Error", compile_options_bits::Caseless).is_literal());
+	EXPECT_FALSE(regex("a.b").is_literal());
+	EXPECT_FALSE(regex("").is_literal());
+	EXPECT_FALSE(regex("error", compile_options_bits::UTF).is_literal());
+	EXPECT_FALSE(regex("error", compile_options_bits::FirstLine).is_literal());
+}
+
+// LITERAL MATCHES ARE THE SAME AS PCRE2 MATCHES
+TEST(LITERAL_TESTS, LITERAL_MATCH_AS_PCRE2) {
+	const std::string text = "aaa ERROR: error, Error and eRRor. ERRO";
+	const std::vector<std::pair<regex, regex> > expressions = {
+		{ regex("error"), regex("(?:error)") },
+		{ regex("aa"), regex("(?:aa)") },
+		{ regex("error", compile_options_bits::Caseless), regex("(?:error)", compile_options_bits::Caseless) },
+		{ regex("r.", compile_options_bits::Literal), regex("r\\.") },
+	};
+
+		for (const auto& [literal, pcre2] : expressions) {
+			EXPECT_TRUE(literal.is_literal());
+			EXPECT_FALSE(pcre2.is_literal());
+
+			EXPECT_EQ(literal.count_matches(text), pcre2.count_matches(text));
+			EXPECT_EQ(literal.count_matches(text, 5), pcre2.count_matches(text, 5));
+			EXPECT_EQ(literal.any_match(text, 30), pcre2.any_match(text, 30));
+			EXPECT_EQ(literal.match(text, 100), pcre2.match(text, 100));
+
+			std::vector<match_result> literal_results;
+			std::vector<match_result> pcre2_results;
+			EXPECT_EQ(literal.match_all(text, literal_results, 2), pcre2.match_all(text, pcre2_results, 2));
+			EXPECT_EQ(literal_results.size(), pcre2_results.size());
+				for (size_t i = 0; i != literal_results.size() && i != pcre2_results.size(); ++i) {
+					EXPECT_EQ(literal_results[i].get_result_global_offset(), pcre2_results[i].get_result_global_offset());
+					EXPECT_EQ(literal_results[i].get_result_relative_offset(), pcre2_results[i].get_result_relative_offset());
+					EXPECT_EQ(literal_results[i].get_result_value(), pcre2_results[i].get_result_value());
+					EXPECT_EQ(literal_results[i].get_sub_results_count(), pcre2_results[i].get_sub_results_count());
+				}
+
+			match_result literal_result;
+			match_result pcre2_result;
+			EXPECT_FALSE(literal.match("xyz", literal_result));
+			EXPECT_FALSE(pcre2.match("xyz", pcre2_result));
+			EXPECT_EQ(literal_result.get_error_code(), pcre2_result.get_error_code());
+		}
+}
+
+// REPLACES MATCHES WITH VALUES RETURNED BY CALLBACK
+TEST(REPLACE_TESTS, REPLACE_WITH_RETURNED_VALUE) {
+	const regex expression("(?<user>\\w+)@(\\w+)\\.pl");
+
+	std::string output;
+	expression.replace_with("mail: jan@firma.pl, ola@dom.pl.", std::back_inserter(output),
+	  [](const match_view& match) -> std::string_view {
+		  EXPECT_TRUE(match.has_sub_value("user"));
+		  EXPECT_EQ(match.get_sub_result_global_offset(1) - match.get_result_global_offset(),
+			match.get_sub_result_size("user") + 1);
+		  return match.get_sub_result_value(1);
+	  });
+	EXPECT_EQ(output, "mail: firma, dom.");
+}
+
+// REPLACES MATCHES WITH VALUES WRITTEN BY CALLBACK
+TEST(REPLACE_TESTS, REPLACE_WITH_WRITTEN_VALUE) {
+	const regex expression("\\d*");
+
+	std::string output;
+	auto out = expression.replace_with("a12b", std::back_inserter(output),
+	  [](const match_view& match, std::back_insert_iterator<std::string> it) {
+		  *it++ = '<';
+		  it	= std::copy(match.get_result_value().begin(), match.get_result_value().end(), it);
+		  *it++ = '>';
+		  return it;
+	  });
+	*out = '!';
+	EXPECT_EQ(output, "<>a<12><>b<>!");
+}
+
+// REPLACES MATCHES WITH STRINGS RETURNED BY CALLBACK
+TEST(REPLACE_TESTS, REPLACE_WITH_RETURNED_STRING) {
+	const regex expression("(?<user>\\w+)@\\w+\\.pl");
+
+	std::string output;
+	expression.replace_with("mail: jan@firma.pl, ola@dom.pl.", std::back_inserter(output), [](const match_view& match) {
+		// longer than small string buffer, so returned string is allocated
+		return "<redacted user " + std::string(match.get_sub_result_value("user")) + " of size " +
+			   std::to_string(match.get_result_size()) + ">";
+	});
+	EXPECT_EQ(output, "mail: <redacted user jan of size 12>, <redacted user ola of size 10>.");
+}
+
+	#if _PCRE2CPP_HAS_EXCEPTIONS
+// REPORTS MATCH ERRORS INSTEAD OF STOPPING REPLACEMENT
+TEST(REPLACE_TESTS, REPLACE_WITH_MATCH_ERROR) {
+	compile_context context;
+	context.set_backtracking_check({ .policy = backtracking_policy::Limit, .match_limit = 1000 });
+	const regex limited("(a+)+b", context);
+
+	std::string output;
+	const auto replace = [](const match_view&) { return std::string_view("-"); };
+	EXPECT_THROW(limited.replace_with("ab aaaaaaaaaaaaaaaaaaaaaaaacb", std::back_inserter(output), replace), u8regex_exception);
+	EXPECT_EQ(output, "-");
+
+	output.clear();
+	const regex utf("x", compile_options_bits::UTF);
+	EXPECT_THROW(utf.replace_with("\xC4\x85x", std::back_inserter(output), replace, 1), u8regex_exception);
+	EXPECT_NO_THROW(utf.replace_with("\xC4\x85x", std::back_inserter(output), replace));
+	EXPECT_EQ(output, "\xC4\x85-");
+}
+	#endif
+
+// TOKENIZES TEXT WITH FIRST MATCHING RULE
+TEST(TOKENIZER_TESTS, PRIORITY_TOKENIZE) {
+	const tokenizer lexer({ { 10, "if" }, { 20, "[a-z]+" }, { 30, "\\d+" }, { 40, "\\s+" } });
+
+	std::vector<token> tokens;
+	EXPECT_TRUE(lexer.tokenize("iffy 42", tokens));
+	EXPECT_EQ(tokens.size(), 4);
+	EXPECT_EQ(tokens[0].id, 10);
+	EXPECT_EQ(tokens[0].offset, 0);
+	EXPECT_EQ(tokens[0].size, 2);
+	EXPECT_EQ(tokens[1].id, 20);
+	EXPECT_EQ(tokens[1].offset, 2);
+	EXPECT_EQ(tokens[1].size, 2);
+	EXPECT_EQ(tokens[2].id, 40);
+	EXPECT_EQ(tokens[3].id, 30);
+	EXPECT_EQ(tokens[3].offset, 5);
+	EXPECT_EQ(tokens[3].size, 2);
+}
+
+// TOKENIZES TEXT WITH LONGEST MATCHING RULE
+TEST(TOKENIZER_TESTS, LONGEST_TOKENIZE) {
+	const tokenizer lexer({ { 10, "if" }, { 20, "[a-z]+" }, { 30, "\\d+" }, { 40, "\\s+" } }, compile_options_bits::None,
+	  token_match_policy::Longest);
+
+	std::vector<token> tokens;
+	EXPECT_TRUE(lexer.tokenize("iffy if", tokens));
+	EXPECT_EQ(tokens.size(), 3);
+	EXPECT_EQ(tokens[0].id, 20);
+	EXPECT_EQ(tokens[0].size, 4);
+	EXPECT_EQ(tokens[1].id, 40);
+	EXPECT_EQ(tokens[2].id, 10);
+	EXPECT_EQ(tokens[2].offset, 5);
+	EXPECT_EQ(tokens[2].size, 2);
+}
+
+// TOKENIZES TEXT WITH LONGEST ALTERNATIVE OF RULES AND GROUPS OF RULES
+TEST(TOKENIZER_TESTS, LONGEST_ALTERNATIVE_TOKENIZE) {
+	const tokenizer lexer({ { 1, "a|abc" }, { 2, "ab" } }, compile_options_bits::None, token_match_policy::Longest);
+
+	std::vector<token> tokens;
+	EXPECT_TRUE(lexer.tokenize("abc", tokens));
+	ASSERT_EQ(tokens.size(), 1);
+	EXPECT_EQ(tokens[0].id, 1);
+	EXPECT_EQ(tokens[0].size, 3);
+
+	// option setting applies to alternatives after it
+	const tokenizer caseless({ { 1, "(?i)x|y" } }, compile_options_bits::None, token_match_policy::Longest);
+	token result {};
+	EXPECT_TRUE(caseless.next_token("Y", 0, result));
+
+	// relative references don't depend on groups of other rules
+	const tokenizer pairs({ { 1, "(a)\\1" }, { 2, "(b)\\g{-1}" } }, compile_options_bits::None, token_match_policy::Longest);
+	tokens.clear();
+	EXPECT_TRUE(pairs.tokenize("aabb", tokens));
+	ASSERT_EQ(tokens.size(), 2);
+	EXPECT_EQ(tokens[1].id, 2);
+
+		#if _PCRE2CPP_HAS_EXCEPTIONS
+	EXPECT_THROW(tokenizer({ { 1, "(a)\\1" }, { 2, "(b)\\1" } }), u8regex_exception);
+	EXPECT_THROW(tokenizer({ { 1, "(?<q>a)" }, { 2, "(?<q>b)" } }), u8regex_exception);
+	EXPECT_NO_THROW(tokenizer({ { 1, "(?<q>a)" }, { 2, "(?<q>b)" } }, compile_options_bits::DupNames));
+	EXPECT_NO_THROW(tokenizer({ { 1, "(a)" }, { 2, "[\\1](?#\\1)\\Q\\1\\E" } }));
+		#endif
+}
+
+// FINDS LONGEST TOKEN WITHOUT BACKTRACKING THROUGH EVERY PATH OF RULES AND REPORTS MATCH ERRORS
+TEST(TOKENIZER_TESTS, LONGEST_PATHOLOGICAL_TOKENIZE) {
+	const tokenizer lexer({ { 1, "(?:a|aa)+" }, { 2, "\\w+\\s*\\w+" }, { 3, "-" } }, compile_options_bits::None,
+	  token_match_policy::Longest);
+
+	std::vector<token> tokens;
+	EXPECT_TRUE(lexer.tokenize(std::string(3000, 'a') + "-", tokens));
+	ASSERT_EQ(tokens.size(), 2);
+	EXPECT_EQ(tokens[0].id, 1);
+	EXPECT_EQ(tokens[0].size, 3000);
+	EXPECT_EQ(tokens[1].id, 3);
+
+	// token isn't reported when match limit stops search before all rules were tried
+	const tokenizer limited({ { 1, "a" }, { 2, "(a+)+b" } }, compile_options_bits::None, token_match_policy::Longest);
+	const std::string text = std::string(24, 'a') + "c";
+	token result {};
+	EXPECT_EQ(limited.find_token(text, 0, result), match_error_codes::MatchLimit);
+	EXPECT_FALSE(limited.next_token(text, 0, result));
+	EXPECT_EQ(limited.find_token(text, 24, result), match_error_codes::NoMatch);
+}
+
+// STOPS TOKENIZING AT TEXT WHICH NO RULE MATCHES
+TEST(TOKENIZER_TESTS, TOKENIZE_UNKNOWN_TEXT) {
+	const tokenizer lexer({ { 1, "[a-z]+" }, { 2, "x*" } });
+
+	std::vector<token> tokens;
+	EXPECT_FALSE(lexer.tokenize("ab?cd", tokens));
+	EXPECT_EQ(tokens.size(), 1);
+
+	token result {};
+	EXPECT_FALSE(lexer.next_token("ab?cd", 2, result));
+	EXPECT_TRUE(lexer.next_token("ab?cd", 3, result));
+	EXPECT_EQ(result.offset, 3);
+	EXPECT_EQ(result.size, 2);
+}
+
 // TEST COPYING
 TEST(REGEX_COPY, EXPRESSION_COPY) {
 	const regex* expression		= new regex("\\d+");
@@ -203,6 +564,553 @@ TEST(REGEX_COPY, SUB_VALUES_TABLE_COPY) {
 	EXPECT_EQ(result.get_sub_results_values().size(), 1);
 }
 
+// COMPILE CONTEXT LIMITS PATTERNS
+TEST(COMPILE_CONTEXT_TESTS, LIMITS) {
+	compile_context context;
+	context.set_max_pattern_length(8).set_parens_nest_limit(2);
+
+	EXPECT_TRUE(pcre2cpp::is_pattern_valid("((a))", context));
+	EXPECT_FALSE(pcre2cpp::is_pattern_valid("(((a)))", context));
+	EXPECT_FALSE(pcre2cpp::is_pattern_valid("abcdefghi", context));
+	EXPECT_TRUE(pcre2cpp::is_pattern_valid("abcdefghi"));
+}
+
+// COMPILE CONTEXT SETS NEWLINE CONVENTION
+TEST(COMPILE_CONTEXT_TESTS, NEWLINE) {
+	compile_context context;
+	context.set_newline(newline_type::CR);
+
+	EXPECT_TRUE(regex("a$", context, compile_options_bits::Multiline).match("a\rb"));
+	EXPECT_FALSE(regex("a$", context, compile_options_bits::Multiline).match("a\nb"));
+	EXPECT_TRUE(regex("a$", compile_options_bits::Multiline).match("a\nb"));
+}
+
+// REGEX KEEPS LOCALE TABLES OF COMPILE CONTEXT
+TEST(COMPILE_CONTEXT_TESTS, LOCALE_TABLES) {
+	regex expression("");
+	{
+		compile_context context;
+		EXPECT_FALSE(context.has_locale_tables());
+		context.set_locale_tables();
+		EXPECT_TRUE(context.has_locale_tables());
+
+		expression = regex("error", context, compile_options_bits::Caseless);
+		EXPECT_FALSE(expression.is_literal());
+		EXPECT_TRUE(regex("error", context).is_literal());
+	}
+
+	match_result result;
+	EXPECT_TRUE(expression.match("an ERROR", result));
+	EXPECT_EQ(result.get_result_value(), "ERROR");
+}
+
+// EXTRACTS NAMED GROUPS INTO COLUMNS
+TEST(COLUMN_TESTS, EXTRACT_COLUMNS) {
+	const regex expression("(?<level>[A-Z]+) (?<code>\\d+)?(?: (?<msg>.+))?");
+	const std::vector<std::string_view> rows = { "INFO 200 ok", "no match", "WARN  disk", "ERROR 500" };
+
+	column_batch batch;
+	EXPECT_EQ(expression.extract_columns(rows, batch), 3);
+	EXPECT_EQ(batch.size(), 4);
+	EXPECT_EQ(batch.get_columns().size(), 3);
+	EXPECT_EQ(batch.get_columns()[0].get_name(), "level");
+	EXPECT_EQ(batch.get_columns()[2].get_name(), "msg");
+
+	EXPECT_TRUE(batch.is_matched(0));
+	EXPECT_FALSE(batch.is_matched(1));
+	EXPECT_EQ(batch.get_value("level", 0), "INFO");
+	EXPECT_EQ(batch.get_value("code", 0), "200");
+	EXPECT_EQ(batch.get_value("msg", 0), "ok");
+
+	const column* code = batch.get_column("code");
+	ASSERT_NE(code, nullptr);
+	EXPECT_FALSE(code->is_valid(1));
+	EXPECT_FALSE(code->is_valid(2));
+	EXPECT_TRUE(code->is_valid(3));
+	EXPECT_EQ(code->get_offset(3), 6);
+	EXPECT_EQ(code->get_size(3), 3);
+	EXPECT_EQ(batch.get_value("msg", 2), "disk");
+	EXPECT_FALSE(batch.get_column("msg")->is_valid(3));
+
+	EXPECT_EQ(expression.extract_columns({ "DEBUG 1" }, batch), 1);
+	EXPECT_EQ(batch.size(), 1);
+	EXPECT_EQ(batch.get_value("code", 0), "1");
+}
+
+struct extracted_log_line {
+	std::string_view level;
+	int code = -1;
+	std::optional<double> took;
+};
+
+template<>
+struct pcre2cpp::extraction_traits<extracted_log_line> {
+	static constexpr auto fields = std::make_tuple(bind_field("level", &extracted_log_line::level),
+	  bind_field("code", &extracted_log_line::code), bind_field("took", &extracted_log_line::took));
+};
+
+// EXTRACTS NAMED GROUPS INTO STRUCT FIELDS
+TEST(EXTRACT_TESTS, EXTRACT_STRUCT) {
+	const regex expression("(?<level>[A-Z]+) (?<code>-?\\d+)(?: (?<took>[\\d.]+)ms)?");
+
+	const std::optional<extracted_log_line> full = expression.extract<extracted_log_line>("> WARN 404 1.5ms");
+	ASSERT_TRUE(full.has_value());
+	EXPECT_EQ(full->level, "WARN");
+	EXPECT_EQ(full->code, 404);
+	ASSERT_TRUE(full->took.has_value());
+	EXPECT_DOUBLE_EQ(*full->took, 1.5);
+
+	const std::optional<extracted_log_line> partial = expression.extract<extracted_log_line>("INFO 200");
+	ASSERT_TRUE(partial.has_value());
+	EXPECT_EQ(partial->code, 200);
+	EXPECT_FALSE(partial->took.has_value());
+
+	EXPECT_FALSE(expression.extract<extracted_log_line>("nothing").has_value());
+	EXPECT_FALSE(expression.extract<extracted_log_line>("INFO 99999999999").has_value());
+	EXPECT_FALSE(expression.extract<extracted_log_line>("INFO 1 1.2.3ms").has_value());
+}
+
+// PARSES RESULTS WITHOUT ALLOCATION
+TEST(EXTRACT_TESTS, GET_RESULT_AS) {
+	const regex expression("(?<host>[a-z.]+):(?<port>\\d+)(?:/(?<ratio>[\\d.]+))?");
+
+	match_result result;
+	EXPECT_TRUE(expression.match("connect to example.com:8080/0.25 now", result));
+	EXPECT_EQ(result.get_sub_result_as<int>("port"), 8080);
+	EXPECT_EQ(result.get_sub_result_as<uint16_t>(1), 8080);
+	EXPECT_EQ(result.get_sub_result_as<std::string_view>("host"), "example.com");
+	EXPECT_DOUBLE_EQ(result.get_sub_result_as<double>("ratio").value_or(0.0), 0.25);
+	EXPECT_FALSE(result.get_sub_result_as<int>("host").has_value());
+	EXPECT_FALSE(result.get_sub_result_as<int8_t>("port").has_value());
+	EXPECT_FALSE(result.get_sub_result_as<int>("missing").has_value());
+	EXPECT_FALSE(result.get_sub_result_as<int>(7).has_value());
+	EXPECT_FALSE(result.get_result_as<int>().has_value());
+
+	EXPECT_TRUE(expression.match("localhost:22", result));
+	EXPECT_FALSE(result.get_sub_result_as<double>("ratio").has_value());
+
+	EXPECT_TRUE(regex("\\d+").match("id 42", result));
+	EXPECT_EQ(result.get_result_as<long>(), 42);
+
+	EXPECT_FALSE(expression.match("nothing", result));
+	EXPECT_FALSE(result.get_sub_result_as<int>("port").has_value());
+}
+
+// UPDATED INDEX IS THE SAME AS REBUILT INDEX
+TEST(MATCH_INDEX_TESTS, UPDATE_AS_BUILD) {
+	const std::vector<regex> expressions = { regex("\\d+"), regex("(?<=a)b+"), regex("x*"), regex("\\bab\\b"),
+		regex("a(?:bc)?") };
+	// the first edit extends match before it (ab -> abc)
+	const std::vector<std::tuple<size_t, size_t, std::string> > edits = {
+		{ 2, 1, "c" }, { 0, 0, "12" }, { 5, 3, "" }, { 7, 1, "b" }, { 3, 0, "a b" }, { 20, 4, "xx9x" }, { 0, 2, "ab" },
+		{ 14, 0, " " },
+	};
+
+		for (const regex& expression : expressions) {
+			std::string text = "ab 12 abb x 345 xx ab, b9 abbb";
+			match_index index(expression);
+			index.build(text);
+
+				for (const auto& [offset, removed, inserted] : edits) {
+					text.replace(offset, removed, inserted);
+					index.update(text, offset, removed, inserted.size());
+
+					match_index rebuilt(expression);
+					rebuilt.build(text);
+					ASSERT_EQ(index.size(), rebuilt.size());
+						for (size_t i = 0; i != index.size(); ++i) {
+							EXPECT_EQ(index.get_matches()[i].offset, rebuilt.get_matches()[i].offset);
+							EXPECT_EQ(index.get_matches()[i].size, rebuilt.get_matches()[i].size);
+						}
+				}
+		}
+}
+
+// MATCHING WITHOUT RESULT DOESN'T ALLOCATE
+TEST(ALLOCATION_TESTS, MATCH_WITHOUT_RESULT) {
+	const regex expression("(\\w+)@(\\w+)\\.com", alloc_counter::get_compile_context());
+	const std::string text = "contact: test@example.com, other@mail.com";
+	// first match with each match data (full and minimal) allocates pcre2 match frames, which are reused later
+	EXPECT_TRUE(expression.match(text));
+	EXPECT_TRUE(expression.any_match(text));
+
+	size_t match_start;
+	size_t match_end;
+	alloc_counter::scope scope;
+	const bool is_matched = expression.match(text) && expression.any_match(text) &&
+							expression.find(text, match_start, match_end) && expression.count_matches(text) == 2;
+	const alloc_counter::alloc_stats stats = scope.get();
+
+	EXPECT_TRUE(is_matched);
+	EXPECT_EQ(stats.allocations, 0);
+	EXPECT_EQ(stats.pcre2_allocations, 0);
+}
+
+// MATCHING WITH RESULT STAYS IN ALLOCATION BUDGET
+TEST(ALLOCATION_TESTS, MATCH_WITH_RESULT) {
+	// sub results vector and values not fitting in small string buffer
+	constexpr size_t match_budget	  = 2;
+	// results vector growth and match_budget per match
+	constexpr size_t match_all_budget = 6;
+
+	const regex expression("(\\w+)@(\\w+)\\.com", alloc_counter::get_compile_context());
+	const std::string text = "contact: test@example.com, other@mail.com";
+	EXPECT_TRUE(expression.match(text));
+
+	match_result result;
+	std::vector<match_result> results;
+	alloc_counter::alloc_stats match_stats;
+	alloc_counter::alloc_stats match_all_stats;
+	{
+		alloc_counter::scope scope;
+		EXPECT_TRUE(expression.match(text, result));
+		match_stats = scope.get();
+	}
+	{
+		alloc_counter::scope scope;
+		EXPECT_TRUE(expression.match_all(text, results));
+		match_all_stats = scope.get();
+	}
+
+	EXPECT_LE(match_stats.total(), match_budget);
+	EXPECT_LE(match_all_stats.total(), match_all_budget);
+}
+
+// MATCH ALL INTO REUSED BATCH DOESN'T ALLOCATE
+TEST(ALLOCATION_TESTS, MATCH_ALL_BATCH_REUSE) {
+	const regex expression("(\\w+)@(\\w+)\\.com", alloc_counter::get_compile_context());
+
+	match_batch batch;
+	EXPECT_TRUE(expression.match_all("contact: test@example.com, other@mail.com", batch));
+	const auto subject = batch.get_subject_ptr();
+
+	alloc_counter::scope scope;
+	const bool is_matched				   = expression.match_all(subject, batch);
+	const alloc_counter::alloc_stats stats = scope.get();
+
+	EXPECT_TRUE(is_matched);
+	EXPECT_EQ(batch.size(), 2);
+	EXPECT_EQ(stats.total(), 0);
+}
+
+// PCRE2 ALLOCATES WITH MEMORY FUNCTIONS OF COMPILE CONTEXT
+TEST(ALLOCATION_TESTS, PCRE2_MEMORY_FUNCTIONS) {
+	const compile_context context = alloc_counter::get_compile_context();
+	EXPECT_TRUE(context.has_memory_functions());
+	EXPECT_FALSE(compile_context().has_memory_functions());
+
+	alloc_counter::scope scope;
+	const regex expression("a+b", context);
+	const alloc_counter::alloc_stats stats = scope.get();
+
+	// compiled code and match data
+	EXPECT_GE(stats.pcre2_allocations, 2);
+	EXPECT_GT(stats.pcre2_bytes, 0);
+	EXPECT_TRUE(expression.match("aab"));
+}
+
+// MATCHES FOUND IN PARTS ARE THE SAME AS FROM MATCH ALL
+TEST(STREAM_TESTS, FEED_AS_MATCH_ALL) {
+	const auto feed_as_match_all = [](const regex& expression, const std::string& text) {
+		std::vector<match_result> results;
+		expression.match_all(text, results);
+
+			for (const size_t part_size : { 1, 2, 3, 7, 64 }) {
+				std::vector<match_span> matches;
+				const auto on_match = [&](const match_span& span) { matches.push_back(span); };
+
+				stream_matcher matcher(expression);
+					for (size_t offset = 0; offset < text.size(); offset += part_size) {
+						EXPECT_EQ(matcher.feed(std::string_view(text).substr(offset, part_size), on_match),
+						  match_error_codes::None);
+					}
+				EXPECT_EQ(matcher.finish(on_match), match_error_codes::None);
+
+				ASSERT_EQ(matches.size(), results.size());
+					for (size_t i = 0; i != matches.size(); ++i) {
+						EXPECT_EQ(matches[i].offset, results[i].get_result_global_offset());
+						EXPECT_EQ(matches[i].size, results[i].get_result_size());
+					}
+			}
+	};
+
+	const std::string text = "ab 12\nabb x 345\nxx ab, b9 abbb\na";
+		for (const regex& expression : { regex("\\d+"), regex("(?<=a)b+"), regex("x*"), regex("(?m)^ab\\b"), regex("a$"),
+			   regex("\\Gab"), regex("\\Aab\\s\\d") }) {
+			feed_as_match_all(expression, text);
+		}
+
+	// window is trimmed at character boundaries, so parts can end in the middle of character
+	const std::string utf_text = "\xC4\x85" "b \xC4\x85\xC4\x85" "b\xC5\xBC \xC5\xBC\xC4\x85" "b\xC4\x85";
+		for (const regex& expression : { regex("(?<=\xC4\x85)b", compile_options_bits::UTF),
+			   regex("\\b\\w", compile_options_bits::UTF | compile_options_bits::UCP),
+			   regex("x*", compile_options_bits::UTF) }) {
+			feed_as_match_all(expression, utf_text);
+		}
+}
+
+// REPORTS MATCH ERRORS OF PARTS
+TEST(STREAM_TESTS, FEED_MATCH_ERROR) {
+	compile_context context;
+	context.set_backtracking_check({ .policy = backtracking_policy::Limit, .match_limit = 1000 });
+	stream_matcher matcher(regex("(a+)+b", context));
+
+	size_t count		= 0;
+	const auto on_match = [&](const match_span&) { ++count; };
+	EXPECT_EQ(matcher.feed("ab aaaaaaaaaaaa", on_match), match_error_codes::None);
+	EXPECT_EQ(matcher.feed("aaaaaaaaaaaacb", on_match), match_error_codes::MatchLimit);
+	EXPECT_EQ(matcher.feed("ab", on_match), match_error_codes::MatchLimit);
+	EXPECT_EQ(matcher.finish(on_match), match_error_codes::MatchLimit);
+	EXPECT_EQ(count, 1);
+
+	// reset clears error
+	EXPECT_EQ(matcher.feed("ab", on_match), match_error_codes::None);
+	EXPECT_EQ(matcher.finish(on_match), match_error_codes::None);
+	EXPECT_EQ(count, 2);
+}
+
+// SCANS FILE IN BUFFERS
+TEST(STREAM_TESTS, FILE_SCANNER) {
+	const std::string path = (std::filesystem::temp_directory_path() / "pcre2cpp_file_scanner.txt").string();
+	const std::string text = "key=1 other=22\nlast=333";
+	std::FILE* file		   = std::fopen(path.c_str(), "wb");
+	ASSERT_NE(file, nullptr);
+	std::fwrite(text.data(), 1, text.size(), file);
+	std::fclose(file);
+
+	file_scanner scanner(regex("\\w+=\\d+"), 4, 2, scan_backend::Blocking);
+	std::vector<match_span> matches;
+	EXPECT_TRUE(scanner.scan(path, matches));
+	EXPECT_EQ(scanner.get_last_backend(), scan_backend::Blocking);
+	ASSERT_EQ(matches.size(), 3);
+	EXPECT_EQ(text.substr(matches[1].offset, matches[1].size), "other=22");
+	EXPECT_EQ(text.substr(matches[2].offset, matches[2].size), "last=333");
+
+	// io_uring backend (or blocking one when it isn't compiled in) finds the same matches
+	file_scanner uring_scanner(regex("\\w+=\\d+"), 4, 2, scan_backend::IoUring);
+	std::vector<match_span> uring_matches;
+	EXPECT_TRUE(uring_scanner.scan(path, uring_matches));
+	EXPECT_EQ(uring_scanner.get_last_backend(), file_scanner::has_io_uring() ? scan_backend::IoUring : scan_backend::Blocking);
+	ASSERT_EQ(uring_matches.size(), matches.size());
+		for (size_t i = 0; i != matches.size(); ++i) {
+			EXPECT_EQ(uring_matches[i].offset, matches[i].offset);
+			EXPECT_EQ(uring_matches[i].size, matches[i].size);
+		}
+
+	std::filesystem::remove(path);
+	EXPECT_FALSE(scanner.scan(path, matches));
+
+		#ifdef __linux__
+	// procfs file reports size 0, but it is read until end of file
+	file_scanner proc_scanner(regex("Name:"), 16, 2, scan_backend::IoUring);
+	std::vector<match_span> proc_matches;
+	EXPECT_TRUE(proc_scanner.scan("/proc/self/status", proc_matches));
+	EXPECT_EQ(proc_matches.size(), 1);
+		#endif
+}
+
+	#if _PCRE2CPP_HAS_STATS
+// RECORDS MATCHES, MISSES AND LIMIT ERRORS OF REGEX AND ITS COPIES
+TEST(STATS_TESTS, RECORD_MATCHES) {
+	const regex expression("(*LIMIT_MATCH=100)(a+)+b");
+	const regex copy = expression;
+	EXPECT_TRUE(expression.match("xaab"));
+	EXPECT_FALSE(copy.match("xyz"));
+	EXPECT_FALSE(expression.match("aaaaaaaaaaaaaaaaaaaaaaaacb"));
+
+	const regex_stats_snapshot stats = expression.get_stats();
+	EXPECT_EQ(stats.pattern, "(*LIMIT_MATCH=100)(a+)+b");
+	EXPECT_EQ(stats.calls, 3);
+	EXPECT_EQ(stats.matches, 1);
+	EXPECT_EQ(stats.misses, 1);
+	EXPECT_EQ(stats.limit_errors, 1);
+	EXPECT_EQ(stats.chars_scanned, 4 + 3 + 26);
+
+	uint64_t bucketed = 0;
+		for (const uint64_t bucket : stats.latency_buckets) { bucketed += bucket; }
+	EXPECT_EQ(bucketed, stats.calls);
+
+	// separately compiled regex with the same pattern and compile options is summed into the same series
+	const regex same_pattern("(*LIMIT_MATCH=100)(a+)+b");
+	EXPECT_TRUE(same_pattern.match("ab"));
+	const regex caseless("(*LIMIT_MATCH=100)(a+)+b", compile_options_bits::Caseless);
+	EXPECT_TRUE(caseless.match("AB"));
+
+	std::string prometheus			  = get_prometheus_stats();
+	const std::string labels		  = "{pattern=\"(*LIMIT_MATCH=100)(a+)+b\",options=\"0x0\"}";
+	const std::string series		  = "pcre2cpp_match_calls_total" + labels;
+	const std::string caseless_series = "pcre2cpp_match_calls_total{pattern=\"(*LIMIT_MATCH=100)(a+)+b\",options=\"0x8\"}";
+	EXPECT_NE(prometheus.find(series + " 4"), std::string::npos);
+	EXPECT_EQ(prometheus.find(series, prometheus.find(series) + 1), std::string::npos);
+	EXPECT_NE(prometheus.find(caseless_series + " 1"), std::string::npos);
+	EXPECT_NE(prometheus.find("pcre2cpp_limit_errors_total" + labels + " 1"), std::string::npos);
+	EXPECT_NE(prometheus.find("pcre2cpp_match_duration_seconds_count" + labels + " 4"), std::string::npos);
+
+	// reset doesn't change exported totals and destroyed regex stays counted
+	copy.reset_stats();
+	EXPECT_EQ(expression.get_stats().calls, 0);
+	EXPECT_EQ(expression.get_stats().chars_scanned, 0);
+	{
+		const regex temporary("(*LIMIT_MATCH=100)(a+)+b");
+		EXPECT_TRUE(temporary.match("ab"));
+	}
+	EXPECT_TRUE(expression.match("ab"));
+	EXPECT_EQ(expression.get_stats().calls, 1);
+
+	prometheus = get_prometheus_stats();
+	EXPECT_NE(prometheus.find(series + " 6"), std::string::npos);
+	EXPECT_NE(prometheus.find("pcre2cpp_match_duration_seconds_count" + labels + " 6"), std::string::npos);
+}
+	#endif
+
+	#if _PCRE2CPP_HAS_SLOW_MATCH_LOG
+// RECORDS MATCHES STOPPED BY LIMIT AND MATCHES LONGER THAN THRESHOLD
+TEST(SLOW_MATCH_LOG_TESTS, RECORD_SLOW_MATCHES) {
+	slow_match_log& log = slow_match_log::get_instance();
+	log.clear();
+	log.enable(std::chrono::nanoseconds(0));
+
+	regex expression("(*LIMIT_MATCH=100)(a+)+b");
+	EXPECT_TRUE(expression.match("xaab"));
+	EXPECT_FALSE(expression.match("aaaaaaaaaaaaaaaaaaaaaaaacb", 1));
+
+	std::vector<slow_match_entry> entries = log.get_entries();
+	ASSERT_EQ(entries.size(), 1);
+	EXPECT_EQ(entries[0].pattern, "(*LIMIT_MATCH=100)(a+)+b");
+	EXPECT_EQ(entries[0].code, match_error_codes::MatchLimit);
+	EXPECT_EQ(entries[0].subject_length, 26);
+	EXPECT_EQ(entries[0].subject_prefix, "aaaaaaaaaaaaaaaaaaaaaaacb");
+
+	expression.set_slow_match_threshold(std::chrono::nanoseconds(1));
+	const std::string long_subject(1000, 'x');
+	EXPECT_FALSE(expression.match(long_subject));
+	entries = log.get_entries();
+	ASSERT_EQ(entries.size(), 2);
+	EXPECT_EQ(entries[1].code, match_error_codes::NoMatch);
+	EXPECT_EQ(entries[1].subject_prefix.size(), slow_match_log::max_subject_size);
+	EXPECT_NE(log.dump().find("code=-47"), std::string::npos);
+
+	log.disable();
+	EXPECT_FALSE(expression.match(long_subject));
+	EXPECT_EQ(log.get_entries().size(), 2);
+	log.clear();
+	EXPECT_TRUE(log.get_entries().empty());
+}
+	#endif
+
+// PROFILER MAPS ENTRIES AND BACKTRACKS TO PATTERN ITEMS
+TEST(PROFILER_TESTS, ITEM_PROFILE) {
+	regex_profiler profiler("(a+)+b");
+	EXPECT_FALSE(profiler.match("aaaaaaaacb"));
+
+	const regex_profile profile = profiler.get_profile();
+	EXPECT_EQ(profile.match_calls, 1);
+	EXPECT_GT(profile.backtracks, 0);
+	ASSERT_FALSE(profile.items.empty());
+
+	size_t entered	  = 0;
+	size_t backtracks = 0;
+		for (const pattern_item_profile& item : profile.items) {
+			entered	   += item.entered;
+			backtracks += item.backtracks;
+				if (item.pattern_offset == 1) { EXPECT_EQ(profiler.get_pattern().substr(1, item.length), "a+"); }
+		}
+	EXPECT_EQ(entered, profile.entered);
+	EXPECT_EQ(backtracks, profile.backtracks);
+	EXPECT_NE(profiler.get_report(1).find("backtracks: " + std::to_string(profile.backtracks)), std::string::npos);
+
+	profiler.reset();
+	EXPECT_EQ(profiler.count_matches("12b ab aab"), 2);
+	EXPECT_EQ(profiler.get_profile().match_calls, 3);
+}
+
+// BACKTRACKING ANALYZER FINDS DANGEROUS PARTS OF PATTERN
+TEST(BACKTRACKING_ANALYZER_TESTS, ANALYZE_PATTERNS) {
+	std::vector<backtracking_warning> warnings = backtracking_analyzer::analyze("x(a+)+$");
+	ASSERT_EQ(warnings.size(), 1);
+	EXPECT_EQ(warnings[0].risk, backtracking_risk::Exponential);
+	EXPECT_EQ(warnings[0].offset, 1);
+	EXPECT_EQ(warnings[0].size, 5);
+
+	EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze("(\\w|\\d)+x")), backtracking_risk::Exponential);
+	EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze("\\d+\\d+")), backtracking_risk::Polynomial);
+	EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze("(\\w+\\s)+")), backtracking_risk::None);
+	EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze("(a++)+b")), backtracking_risk::None);
+	EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze("(ab|ac)*")), backtracking_risk::None);
+
+	// NON-CAPTURING AND NAMED GROUPS
+	for (const char* const pattern : { "(?:a+)+$", "(?:x+x+)+y", "(?:a|aa)+$", "(?:b|a+)*c", "(?<n>a+)+$", "(?P<n>a+)+$",
+									   "(?'n'a+)+$", "(?>x)(?:a+)+$", "(?i)(?:a+)+$", "(?x-i:a+)+$" }) {
+		EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze(pattern)), backtracking_risk::Exponential)
+			<< pattern;
+	}
+	EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze("(?:a++)+b")), backtracking_risk::None);
+	EXPECT_EQ(backtracking_analyzer::get_risk(backtracking_analyzer::analyze("(?i)ab")), backtracking_risk::None);
+
+	compile_context context;
+	context.set_backtracking_check({ .policy = backtracking_policy::Limit, .match_limit = 1000 });
+	const regex limited("(a+)+b", context);
+	EXPECT_EQ(limited.get_backtracking_warnings().size(), 1);
+	match_result result;
+	EXPECT_FALSE(limited.match_at("aaaaaaaaaaaaaaaaaaaaaaaacb", result, 1));
+	EXPECT_EQ(result.get_error_code(), match_error_codes::MatchLimit);
+	EXPECT_TRUE(regex("\\d+\\d+", context).get_backtracking_warnings().empty());
+
+		#if _PCRE2CPP_HAS_EXCEPTIONS
+	context.set_backtracking_check({ .policy = backtracking_policy::Reject });
+	EXPECT_THROW(regex("(a+)+b", context), u8regex_exception);
+	EXPECT_NO_THROW(regex("(a++)+b", context));
+		#endif
+}
+
+	#if _PCRE2CPP_HAS_PMR
+// counts allocations which reach it
+class counting_memory_resource : public std::pmr::memory_resource {
+public:
+	size_t allocations = 0;
+
+private:
+	void* do_allocate(const size_t bytes, const size_t alignment) override {
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* ptr, const size_t bytes, const size_t alignment) override {
+		std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// ALL RESULTS STORAGE COMES FROM MEMORY RESOURCE
+TEST(PMR_TESTS, MATCH_ALL_USES_RESOURCE) {
+	const regex expression("(?<key>\\w+)=(?<value>\\w+)");
+	const std::string text = "first_key=first_value second_key=second_value third_key=third_value";
+
+	counting_memory_resource default_resource;
+	std::pmr::memory_resource* previous = std::pmr::set_default_resource(&default_resource);
+	{
+		std::pmr::monotonic_buffer_resource arena(std::pmr::new_delete_resource());
+		std::pmr::vector<pmr::match_result> results(&arena);
+		EXPECT_TRUE(expression.match_all(text, results));
+		ASSERT_EQ(results.size(), 3);
+		EXPECT_EQ(results[1].get_result_value(), "second_key=second_value");
+		EXPECT_EQ(results[2].get_sub_result_value("value"), "third_value");
+		EXPECT_EQ(results[2].get_result_global_offset(), 46);
+		EXPECT_EQ(results[0].get_allocator().resource(), &arena);
+
+		pmr::match_result result(&arena);
+		EXPECT_TRUE(expression.match(text, result, 10));
+		EXPECT_EQ(result.get_sub_result_value("key"), "second_key");
+		EXPECT_FALSE(expression.match("", result));
+		EXPECT_EQ(result.get_allocator().resource(), &arena);
+	}
+	std::pmr::set_default_resource(previous);
+
+	EXPECT_EQ(default_resource.allocations, 0);
+}
+	#endif
+
 // TEST IS PATTERN VALID
 TEST(REGEX_VALID, VALID_PATTERN) {
 	EXPECT_TRUE(pcre2cpp::is_pattern_valid("(?<number>\\d+)"));